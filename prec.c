@@ -2,12 +2,39 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <limits.h>
+#ifdef _WIN32
+// Lean headers keep rpcndr.h's "#define small char" out, and NOMINMAX keeps
+// min/max macros away from C++ users of prec.hpp
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
+// Invariant: a precn_t is always normalized, i.e. siz == 0 or a[siz - 1] != 0.
+// Every function that writes a precn_t leaves it normalized, and code that
+// fills limbs by hand must call precn_normalize before passing it on.
+// Functions taking a precn_srcptr only read it (neither the struct nor its
+// limbs), so a value can be shared by any number of threads as long as no
+// thread modifies it.
 struct __precn_struct {
     int siz, alloc_size;
     uint32_t *a; // little endian
 };
 typedef struct __precn_struct *precn_t;
+typedef const struct __precn_struct *precn_srcptr;
 
 // Allocate a new high-precision integer with given size (number of uint32_t digits)
 precn_t precn_new(int size) {
@@ -33,7 +60,7 @@ void precn_zero(precn_t n) {
 }
 
 // Copy src to dst
-void precn_copy(precn_t dst, const precn_t src) {
+void precn_copy(precn_t dst, precn_srcptr src) {
     if (dst->alloc_size < src->siz) {
         dst->a = (uint32_t*)realloc(dst->a, src->siz * sizeof(uint32_t));
         dst->alloc_size = src->siz;
@@ -58,9 +85,7 @@ void precn_normalize(precn_t n) {
 }
 
 // Compare a and b: returns -1 if a < b, 0 if a == b, 1 if a > b
-int precn_cmp(const precn_t a, const precn_t b) {
-    precn_normalize((precn_t)a);
-    precn_normalize((precn_t)b);
+int precn_cmp(precn_srcptr a, precn_srcptr b) {
     if (a->siz < b->siz) return -1;
     if (a->siz > b->siz) return 1;
     for (int i = a->siz - 1; i >= 0; --i) {
@@ -71,7 +96,7 @@ int precn_cmp(const precn_t a, const precn_t b) {
 }
 
 // Addition: res = a + b
-void precn_add(precn_t res, const precn_t a, const precn_t b) {
+void precn_add(precn_t res, precn_srcptr a, precn_srcptr b) {
     int max = a->siz > b->siz ? a->siz : b->siz;
     if (res->alloc_size < max + 1) {
         res->a = (uint32_t*)realloc(res->a, (max + 1) * sizeof(uint32_t));
@@ -94,9 +119,9 @@ void precn_add(precn_t res, const precn_t a, const precn_t b) {
 }
 
 // Subtraction: res = |a - b|
-void precn_sub(precn_t res, const precn_t a, const precn_t b) {
-    precn_t big;
-    precn_t small;
+void precn_sub(precn_t res, precn_srcptr a, precn_srcptr b) {
+    precn_srcptr big;
+    precn_srcptr small;
     int cmp = precn_cmp(a, b);
     if (cmp >= 0) {
         big = a;
@@ -128,15 +153,163 @@ void precn_sub(precn_t res, const precn_t a, const precn_t b) {
     precn_normalize(res);
 }
 
+// Limb-array multiplication kernels
+// Below PRECN_KARATSUBA_THRESHOLD limbs in the shorter operand the schoolbook
+// loop wins; its inner row then fits in L1, so it needs no further blocking.
+// Above it, balanced operands use Karatsuba and operands where one is at
+// least twice as long as the other are cut into chunks the length of the
+// shorter one, so every recursive product is close to square.
+#define PRECN_KARATSUBA_THRESHOLD 32
+
+// r[0..n+m) = a[0..n) * b[0..m); r must not overlap a or b
+static void precn_mul_basecase(uint32_t *r, const uint32_t *a, int n, const uint32_t *b, int m) {
+    memset(r, 0, (n + m) * sizeof(uint32_t));
+    for (int i = 0; i < n; ++i) {
+        uint64_t carry = 0;
+        for (int j = 0; j < m; ++j) {
+            uint64_t prod = (uint64_t)a[i] * b[j] + r[i + j] + carry;
+            r[i + j] = (uint32_t)prod;
+            carry = prod >> 32;
+        }
+        r[i + m] = (uint32_t)carry;
+    }
+}
+
+// r[0..n) = a[0..n) + b[0..m) with n >= m, returns the carry out; r may alias a
+static uint32_t precn_limbs_add(uint32_t *r, const uint32_t *a, int n, const uint32_t *b, int m) {
+    uint64_t carry = 0;
+    int i;
+    for (i = 0; i < m; ++i) {
+        uint64_t sum = (uint64_t)a[i] + b[i] + carry;
+        r[i] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+    for (; i < n; ++i) {
+        uint64_t sum = (uint64_t)a[i] + carry;
+        r[i] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+    return (uint32_t)carry;
+}
+
+// r[0..n) = a[0..n) - b[0..m) with n >= m, returns the borrow out; r may alias a
+static uint32_t precn_limbs_sub(uint32_t *r, const uint32_t *a, int n, const uint32_t *b, int m) {
+    uint32_t borrow = 0;
+    int i;
+    for (i = 0; i < m; ++i) {
+        uint64_t diff = (uint64_t)a[i] - b[i] - borrow;
+        r[i] = (uint32_t)diff;
+        borrow = (uint32_t)(diff >> 63);
+    }
+    for (; i < n; ++i) {
+        uint64_t diff = (uint64_t)a[i] - borrow;
+        r[i] = (uint32_t)diff;
+        borrow = (uint32_t)(diff >> 63);
+    }
+    return borrow;
+}
+
+static void precn_mul_limbs(uint32_t *r, const uint32_t *a, int n, const uint32_t *b, int m);
+
+// Karatsuba step for n >= m > h, where a and b are split at h = ceil(n/2):
+// a * b = z0 + (z1 - z0 - z2) B^h + z2 B^2h with z0 = a0 b0, z2 = a1 b1 and
+// z1 = (a0 + a1)(b0 + b1)
+static void precn_mul_karatsuba(uint32_t *r, const uint32_t *a, int n, const uint32_t *b, int m, int h) {
+    int la = n - h, lb = m - h;
+    uint32_t *sa = (uint32_t*)malloc((4 * h + 4) * sizeof(uint32_t));
+    uint32_t *sb = sa + h + 1;
+    uint32_t *z1 = sb + h + 1;
+    
+    sa[h] = precn_limbs_add(sa, a, h, a + h, la);
+    sb[h] = precn_limbs_add(sb, b, h, b + h, lb);
+    precn_mul_limbs(r, a, h, b, h);
+    if (la >= lb) {
+        precn_mul_limbs(r + 2 * h, a + h, la, b + h, lb);
+    } else {
+        precn_mul_limbs(r + 2 * h, b + h, lb, a + h, la);
+    }
+    precn_mul_limbs(z1, sa, h + 1, sb, h + 1);
+    precn_limbs_sub(z1, z1, 2 * h + 2, r, 2 * h);
+    precn_limbs_sub(z1, z1, 2 * h + 2, r + 2 * h, la + lb);
+    
+    // z1 < B^(n+m-h), so only that many of its limbs can be nonzero
+    int len = n + m - h < 2 * h + 2 ? n + m - h : 2 * h + 2;
+    precn_limbs_add(r + h, r + h, n + m - h, z1, len);
+    free(sa);
+}
+
+// r[0..n+m) = a[0..n) * b[0..m) with n >= m; r must not overlap a or b
+static void precn_mul_limbs(uint32_t *r, const uint32_t *a, int n, const uint32_t *b, int m) {
+    if (m < PRECN_KARATSUBA_THRESHOLD) {
+        precn_mul_basecase(r, a, n, b, m);
+        return;
+    }
+    int h = (n + 1) / 2;
+    if (m > h) {
+        precn_mul_karatsuba(r, a, n, b, m, h);
+        return;
+    }
+    
+    // Unbalanced: multiply b by successive m-limb chunks of a
+    uint32_t *t = (uint32_t*)malloc(2 * m * sizeof(uint32_t));
+    memset(r, 0, (n + m) * sizeof(uint32_t));
+    for (int off = 0; off < n; off += m) {
+        int len = n - off < m ? n - off : m;
+        precn_mul_limbs(t, b, m, a + off, len);
+        precn_limbs_add(r + off, r + off, n + m - off, t, len + m);
+    }
+    free(t);
+}
+
 // Multiplication: res = a * b
-void precn_mul(precn_t res, const precn_t a, const precn_t b) {
+// res must not alias a or b
+void precn_mul(precn_t res, precn_srcptr a, precn_srcptr b) {
     int n = a->siz, m = b->siz;
     int sz = n + m;
     if (res->alloc_size < sz) {
         res->a = (uint32_t*)realloc(res->a, sz * sizeof(uint32_t));
         res->alloc_size = sz;
     }
-    memset(res->a, 0, sz * sizeof(uint32_t));
+    if (n == 0 || m == 0) {
+        res->siz = 0;
+        return;
+    }
+    if (n >= m) {
+        precn_mul_limbs(res->a, a->a, n, b->a, m);
+    } else {
+        precn_mul_limbs(res->a, b->a, m, a->a, n);
+    }
+    res->siz = sz;
+    precn_normalize(res);
+}
+
+// Multiply-accumulate: res = res + a * b
+// res must not alias a or b
+void precn_addmul(precn_t res, precn_srcptr a, precn_srcptr b) {
+    int n = a->siz, m = b->siz;
+    if (n == 0 || m == 0) {
+        return;
+    }
+    int sz = (res->siz > n + m ? res->siz : n + m) + 1;
+    if (res->alloc_size < sz) {
+        res->a = (uint32_t*)realloc(res->a, sz * sizeof(uint32_t));
+        res->alloc_size = sz;
+    }
+    memset(res->a + res->siz, 0, (sz - res->siz) * sizeof(uint32_t));
+    if (n >= PRECN_KARATSUBA_THRESHOLD && m >= PRECN_KARATSUBA_THRESHOLD) {
+        // Form the product with the fast kernels, then add it in one pass
+        uint32_t *prod = (uint32_t*)malloc((n + m) * sizeof(uint32_t));
+        if (n >= m) {
+            precn_mul_limbs(prod, a->a, n, b->a, m);
+        } else {
+            precn_mul_limbs(prod, b->a, m, a->a, n);
+        }
+        precn_limbs_add(res->a, res->a, sz, prod, n + m);
+        free(prod);
+        res->siz = sz;
+        precn_normalize(res);
+        return;
+    }
     for (int i = 0; i < n; ++i) {
         uint64_t carry = 0;
         for (int j = 0; j < m; ++j) {
@@ -144,20 +317,434 @@ void precn_mul(precn_t res, const precn_t a, const precn_t b) {
             res->a[i + j] = (uint32_t)prod;
             carry = prod >> 32;
         }
-        res->a[i + m] = (uint32_t)carry;
+        for (int k = i + m; carry; ++k) {
+            uint64_t sum = (uint64_t)res->a[k] + carry;
+            res->a[k] = (uint32_t)sum;
+            carry = sum >> 32;
+        }
+    }
+    res->siz = sz;
+    precn_normalize(res);
+}
+
+// r[0..2n) = a[0..n)^2 by schoolbook squaring; r must not overlap a
+// Each cross product a_i * a_j (i < j) is formed once and doubled
+static void precn_sqr_basecase(uint32_t *r, const uint32_t *a, int n) {
+    memset(r, 0, 2 * n * sizeof(uint32_t));
+    
+    // Cross products
+    for (int i = 0; i < n; ++i) {
+        uint64_t carry = 0;
+        for (int j = i + 1; j < n; ++j) {
+            uint64_t prod = (uint64_t)a[i] * a[j] + r[i + j] + carry;
+            r[i + j] = (uint32_t)prod;
+            carry = prod >> 32;
+        }
+        r[i + n] = (uint32_t)carry;
+    }
+    
+    // Double them and add the squares on the diagonal
+    uint32_t top = 0;
+    uint64_t carry = 0;
+    for (int i = 0; i < n; ++i) {
+        uint64_t sq = (uint64_t)a[i] * a[i];
+        uint32_t lo = r[2 * i], hi = r[2 * i + 1];
+        uint64_t t = (uint64_t)(uint32_t)(lo << 1 | top) + (uint32_t)sq + carry;
+        top = hi >> 31;
+        r[2 * i] = (uint32_t)t;
+        t = (uint64_t)(uint32_t)(hi << 1 | lo >> 31) + (sq >> 32) + (t >> 32);
+        r[2 * i + 1] = (uint32_t)t;
+        carry = t >> 32;
+    }
+}
+
+// r[0..2n) = a[0..n)^2; r must not overlap a
+// Karatsuba with a split at h = ceil(n/2): a^2 = z0 + (z1 - z0 - z2) B^h + z2 B^2h
+// with z0 = a0^2, z2 = a1^2 and z1 = (a0 + a1)^2, i.e. three half-size squares
+static void precn_sqr_limbs(uint32_t *r, const uint32_t *a, int n) {
+    if (n < PRECN_KARATSUBA_THRESHOLD) {
+        precn_sqr_basecase(r, a, n);
+        return;
+    }
+    int h = (n + 1) / 2, l = n - h;
+    uint32_t *sa = (uint32_t*)malloc((3 * h + 3) * sizeof(uint32_t));
+    uint32_t *z1 = sa + h + 1;
+    
+    sa[h] = precn_limbs_add(sa, a, h, a + h, l);
+    precn_sqr_limbs(r, a, h);
+    precn_sqr_limbs(r + 2 * h, a + h, l);
+    precn_sqr_limbs(z1, sa, h + 1);
+    precn_limbs_sub(z1, z1, 2 * h + 2, r, 2 * h);
+    precn_limbs_sub(z1, z1, 2 * h + 2, r + 2 * h, 2 * l);
+    
+    // z1 < B^(2n-h), so only that many of its limbs can be nonzero
+    int len = 2 * n - h < 2 * h + 2 ? 2 * n - h : 2 * h + 2;
+    precn_limbs_add(r + h, r + h, 2 * n - h, z1, len);
+    free(sa);
+}
+
+// Squaring: res = a * a
+// The schoolbook case forms each cross product once and doubles it, so it
+// does about half the word multiplications of precn_mul(res, a, a); large
+// operands split Karatsuba-style into three half-size squares.
+// res must not alias a
+void precn_sqr(precn_t res, precn_srcptr a) {
+    int n = a->siz;
+    int sz = 2 * n;
+    if (res->alloc_size < sz) {
+        res->a = (uint32_t*)realloc(res->a, (sz > 0 ? sz : 1) * sizeof(uint32_t));
+        res->alloc_size = sz > 0 ? sz : 1;
+    }
+    precn_sqr_limbs(res->a, a->a, n);
+    res->siz = sz;
+    precn_normalize(res);
+}
+
+// Scalar operands
+// These take a machine word directly instead of a precn_t, touch each limb
+// once, and allow res to alias a. In-place add/sub stop as soon as the
+// carry or borrow dies out, so accumulating loops cost O(1) amortized.
+
+// Grow n to hold at least size limbs, zero-filling limbs from n->siz up
+static void precn_grow_zeroed(precn_t n, int size) {
+    if (n->alloc_size < size) {
+        n->a = (uint32_t*)realloc(n->a, size * sizeof(uint32_t));
+        n->alloc_size = size;
+    }
+    if (size > n->siz) {
+        memset(n->a + n->siz, 0, (size - n->siz) * sizeof(uint32_t));
+    }
+}
+
+// Set n to uint64_t value (only the low two limbs are written)
+void precn_set_u64(precn_t n, uint64_t val) {
+    if (n->alloc_size < 2) {
+        n->a = (uint32_t*)realloc(n->a, 2 * sizeof(uint32_t));
+        n->alloc_size = 2;
+    }
+    n->a[0] = (uint32_t)val;
+    n->a[1] = (uint32_t)(val >> 32);
+    n->siz = 2;
+    precn_normalize(n);
+}
+
+// The low two limbs of n as a uint64_t, i.e. its value when n->siz <= 2
+static uint64_t precn_get_u64(precn_srcptr n) {
+    if (n->siz == 0) return 0;
+    return n->a[0] | (n->siz >= 2 ? (uint64_t)n->a[1] << 32 : 0);
+}
+
+// Compare a and val: returns -1 if a < val, 0 if a == val, 1 if a > val
+int precn_cmp_u64(precn_srcptr a, uint64_t val) {
+    if (a->siz > 2) return 1;
+    uint64_t av = precn_get_u64(a);
+    return av < val ? -1 : (av > val ? 1 : 0);
+}
+
+// res = a + val
+void precn_add_u64(precn_t res, precn_srcptr a, uint64_t val) {
+    int n = a->siz;
+    int sz = (n > 2 ? n : 2) + 1;
+    if (res->alloc_size < sz) {
+        res->a = (uint32_t*)realloc(res->a, sz * sizeof(uint32_t));
+        res->alloc_size = sz;
+    }
+    uint64_t carry = val;
+    int i;
+    for (i = 0; i < n && carry; ++i) {
+        uint64_t sum = (uint64_t)a->a[i] + (uint32_t)carry;
+        res->a[i] = (uint32_t)sum;
+        carry = (carry >> 32) + (sum >> 32);
+    }
+    if (res != a) {
+        memcpy(res->a + i, a->a + i, (n - i) * sizeof(uint32_t));
+    }
+    if (i >= n) {
+        for (; carry; ++i) {
+            res->a[i] = (uint32_t)carry;
+            carry >>= 32;
+        }
+    } else {
+        i = n;
+    }
+    res->siz = i;
+    precn_normalize(res);
+}
+
+// Subtraction: res = |a - val|
+void precn_sub_u64(precn_t res, precn_srcptr a, uint64_t val) {
+    if (precn_cmp_u64(a, val) < 0) {
+        uint64_t av = precn_get_u64(a);
+        precn_set_u64(res, val - av);
+        return;
+    }
+    int n = a->siz;
+    if (res->alloc_size < n) {
+        res->a = (uint32_t*)realloc(res->a, n * sizeof(uint32_t));
+        res->alloc_size = n;
+    }
+    uint64_t borrow = val;
+    int i;
+    for (i = 0; i < n && borrow; ++i) {
+        uint32_t w = a->a[i];
+        uint32_t sub = (uint32_t)borrow;
+        res->a[i] = w - sub;
+        borrow = (borrow >> 32) + (w < sub);
+    }
+    if (res != a) {
+        memcpy(res->a + i, a->a + i, (n - i) * sizeof(uint32_t));
+    }
+    res->siz = n;
+    precn_normalize(res);
+}
+
+// Multiplication: res = a * val
+void precn_mul_u64(precn_t res, precn_srcptr a, uint64_t val) {
+    int n = a->siz;
+    if (n == 0 || val == 0) {
+        res->siz = 0;
+        return;
+    }
+    int sz = n + 2;
+    if (res->alloc_size < sz) {
+        res->a = (uint32_t*)realloc(res->a, sz * sizeof(uint32_t));
+        res->alloc_size = sz;
+    }
+    uint32_t v0 = (uint32_t)val, v1 = (uint32_t)(val >> 32);
+    uint64_t carry = 0; // amount still to add at word i
+    for (int i = 0; i < n; ++i) {
+        uint32_t ai = a->a[i];
+        uint64_t t = (uint64_t)ai * v0 + (uint32_t)carry;
+        res->a[i] = (uint32_t)t;
+        carry = (uint64_t)ai * v1 + (t >> 32) + (carry >> 32);
+    }
+    res->a[n] = (uint32_t)carry;
+    res->a[n + 1] = (uint32_t)(carry >> 32);
+    res->siz = sz;
+    precn_normalize(res);
+}
+
+// Multiply-accumulate: res = res + a * val
+void precn_addmul_u64(precn_t res, precn_srcptr a, uint64_t val) {
+    int n = a->siz;
+    if (n == 0 || val == 0) {
+        return;
+    }
+    int sz = (res->siz > n + 2 ? res->siz : n + 2) + 1;
+    precn_grow_zeroed(res, sz);
+    uint32_t v0 = (uint32_t)val, v1 = (uint32_t)(val >> 32);
+    uint64_t carry = 0;
+    int i;
+    for (i = 0; i < n; ++i) {
+        uint32_t ai = a->a[i];
+        uint64_t t = (uint64_t)ai * v0 + res->a[i] + (uint32_t)carry;
+        res->a[i] = (uint32_t)t;
+        carry = (uint64_t)ai * v1 + (t >> 32) + (carry >> 32);
+    }
+    for (; carry; ++i) {
+        uint64_t sum = (uint64_t)res->a[i] + (uint32_t)carry;
+        res->a[i] = (uint32_t)sum;
+        carry = (carry >> 32) + (sum >> 32);
     }
     res->siz = sz;
     precn_normalize(res);
 }
 
+// Number of leading zero bits in a nonzero word
+static int precn_clz32(uint32_t x) {
+    int n = 0;
+    if (x <= 0x0000FFFF) { n += 16; x <<= 16; }
+    if (x <= 0x00FFFFFF) { n += 8; x <<= 8; }
+    if (x <= 0x0FFFFFFF) { n += 4; x <<= 4; }
+    if (x <= 0x3FFFFFFF) { n += 2; x <<= 2; }
+    if (x <= 0x7FFFFFFF) { n += 1; }
+    return n;
+}
+
+// Reciprocal of a normalized (top bit set) divisor: floor((B^2 - 1) / d) - B
+// with B = 2^32, as used by Moller-Granlund division
+static uint32_t precn_reciprocal_2by1(uint32_t d) {
+    return (uint32_t)((((uint64_t)~d << 32) | 0xFFFFFFFF) / d);
+}
+
+// Divide <u1, u0> by normalized d using its reciprocal v (requires u1 < d)
+// Returns the quotient word and stores the remainder in *r
+static uint32_t precn_div_2by1(uint32_t *r, uint32_t u1, uint32_t u0, uint32_t d, uint32_t v) {
+    uint64_t q = (uint64_t)v * u1 + (((uint64_t)u1 << 32) | u0);
+    uint32_t q1 = (uint32_t)(q >> 32) + 1;
+    uint32_t q0 = (uint32_t)q;
+    uint32_t rem = u0 - q1 * d;
+    if (rem > q0) {
+        q1--;
+        rem += d;
+    }
+    if (rem >= d) {
+        q1++;
+        rem -= d;
+    }
+    *r = rem;
+    return q1;
+}
+
+// Reciprocal of a normalized two-word divisor <d1, d0>:
+// floor((B^3 - 1) / <d1, d0>) - B
+static uint32_t precn_reciprocal_3by2(uint32_t d1, uint32_t d0) {
+    uint32_t v = precn_reciprocal_2by1(d1);
+    uint32_t p = d1 * v + d0;
+    if (p < d0) {
+        v--;
+        if (p >= d1) {
+            v--;
+            p -= d1;
+        }
+        p -= d1;
+    }
+    uint64_t t = (uint64_t)d0 * v;
+    uint32_t t1 = (uint32_t)(t >> 32), t0 = (uint32_t)t;
+    p += t1;
+    if (p < t1) {
+        v--;
+        if (p > d1 || (p == d1 && t0 >= d0)) {
+            v--;
+        }
+    }
+    return v;
+}
+
+// Divide <u2, u1, u0> by normalized d = <d1, d0> using its reciprocal v
+// (requires <u2, u1> < d). Returns the quotient word; *r gets the remainder.
+static uint32_t precn_div_3by2(uint64_t *r, uint32_t u2, uint32_t u1, uint32_t u0, uint64_t d, uint32_t v) {
+    uint32_t d1 = (uint32_t)(d >> 32), d0 = (uint32_t)d;
+    uint64_t q = (uint64_t)v * u2 + (((uint64_t)u2 << 32) | u1);
+    uint32_t q1 = (uint32_t)(q >> 32), q0 = (uint32_t)q;
+    uint32_t r1 = u1 - q1 * d1;
+    uint64_t rem = (((uint64_t)r1 << 32) | u0) - (uint64_t)d0 * q1 - d;
+    q1++;
+    if ((uint32_t)(rem >> 32) >= q0) {
+        q1--;
+        rem += d;
+    }
+    if (rem >= d) {
+        q1++;
+        rem -= d;
+    }
+    *r = rem;
+    return q1;
+}
+
+// Word of a shifted left by s bits (0 <= s < 32) at index i, for 0 <= i <= a->siz
+static uint32_t precn_shifted_limb(precn_srcptr a, int i, int s) {
+    uint32_t hi = i < a->siz ? a->a[i] : 0;
+    if (s == 0) {
+        return hi;
+    }
+    uint32_t lo = i > 0 ? a->a[i - 1] : 0;
+    return (hi << s) | (lo >> (32 - s));
+}
+
+// Make room for an n-limb quotient
+static void precn_reserve_quotient(precn_t quotient, int n) {
+    if (quotient->alloc_size < n) {
+        quotient->a = (uint32_t*)realloc(quotient->a, n * sizeof(uint32_t));
+        quotient->alloc_size = n;
+    }
+}
+
+// Single-word division: quotient = dividend / divisor, *remainder = dividend % divisor
+// Uses a precomputed reciprocal, so the loop has no hardware divide.
+// quotient may alias dividend, or be NULL when only the remainder is wanted;
+// remainder may be NULL. Returns 0 on success, -1 if divisor is zero
+int precn_divmod_u32(precn_t quotient, uint32_t *remainder, precn_srcptr dividend, uint32_t divisor) {
+    if (divisor == 0) {
+        return -1;
+    }
+    int n = dividend->siz;
+    int s = precn_clz32(divisor);
+    uint32_t d = divisor << s;
+    uint32_t v = precn_reciprocal_2by1(d);
+    if (quotient) {
+        precn_reserve_quotient(quotient, n);
+    }
+
+    uint32_t r = precn_shifted_limb(dividend, n, s);
+    for (int i = n - 1; i >= 0; i--) {
+        uint32_t q = precn_div_2by1(&r, r, precn_shifted_limb(dividend, i, s), d, v);
+        if (quotient) {
+            quotient->a[i] = q;
+        }
+    }
+    if (quotient) {
+        quotient->siz = n;
+        precn_normalize(quotient);
+    }
+    if (remainder) {
+        *remainder = r >> s;
+    }
+    return 0;
+}
+
+// Two-word division: quotient = dividend / divisor, *remainder = dividend % divisor
+// Same aliasing rules as precn_divmod_u32. Returns 0 on success, -1 if divisor is zero
+int precn_divmod_u64(precn_t quotient, uint64_t *remainder, precn_srcptr dividend, uint64_t divisor) {
+    if (divisor >> 32 == 0) {
+        uint32_t r32 = 0;
+        int result = precn_divmod_u32(quotient, &r32, dividend, (uint32_t)divisor);
+        if (remainder) {
+            *remainder = r32;
+        }
+        return result;
+    }
+    int n = dividend->siz;
+    int s = precn_clz32((uint32_t)(divisor >> 32));
+    uint64_t d = divisor << s;
+    uint32_t v = precn_reciprocal_3by2((uint32_t)(d >> 32), (uint32_t)d);
+    if (quotient) {
+        precn_reserve_quotient(quotient, n);
+    }
+
+    uint64_t r = precn_shifted_limb(dividend, n, s);
+    for (int i = n - 1; i >= 0; i--) {
+        uint32_t q = precn_div_3by2(&r, (uint32_t)(r >> 32), (uint32_t)r,
+                                    precn_shifted_limb(dividend, i, s), d, v);
+        if (quotient) {
+            quotient->a[i] = q;
+        }
+    }
+    if (quotient) {
+        quotient->siz = n;
+        precn_normalize(quotient);
+    }
+    if (remainder) {
+        *remainder = r >> s;
+    }
+    return 0;
+}
+
 // Division with remainder: quotient = dividend / divisor, remainder = dividend % divisor
 // Returns 0 on success, -1 if divisor is zero
-int precn_divmod(precn_t quotient, precn_t remainder, const precn_t dividend, const precn_t divisor) {
+int precn_divmod(precn_t quotient, precn_t remainder, precn_srcptr dividend, precn_srcptr divisor) {
     // Check for division by zero
     if (divisor->siz == 0) {
         return -1;
     }
     
+    // One- and two-word divisors take the reciprocal-based paths
+    if (divisor->siz <= 2) {
+        uint64_t d = precn_get_u64(divisor);
+        uint64_t r;
+        precn_divmod_u64(quotient, &r, dividend, d);
+        if (remainder->alloc_size < 2) {
+            remainder->a = (uint32_t*)realloc(remainder->a, 2 * sizeof(uint32_t));
+            remainder->alloc_size = 2;
+        }
+        precn_zero(remainder);
+        remainder->a[0] = (uint32_t)r;
+        remainder->a[1] = (uint32_t)(r >> 32);
+        remainder->siz = 2;
+        precn_normalize(remainder);
+        return 0;
+    }
+    
     // If dividend < divisor, quotient = 0, remainder = dividend
     if (precn_cmp(dividend, divisor) < 0) {
         precn_zero(quotient);
@@ -165,15 +752,20 @@ int precn_divmod(precn_t quotient, precn_t remainder, const precn_t dividend, co
         return 0;
     }
     
-    // Initialize quotient and remainder
-    precn_zero(quotient);
-    precn_zero(remainder);
-    
-    // Ensure quotient has enough space
+    // Ensure quotient has enough space, and room in remainder for the
+    // extra word a shifted partial remainder can carry into
     if (quotient->alloc_size < dividend->siz) {
         quotient->a = (uint32_t*)realloc(quotient->a, dividend->siz * sizeof(uint32_t));
         quotient->alloc_size = dividend->siz;
     }
+    if (remainder->alloc_size < divisor->siz + 1) {
+        remainder->a = (uint32_t*)realloc(remainder->a, (divisor->siz + 1) * sizeof(uint32_t));
+        remainder->alloc_size = divisor->siz + 1;
+    }
+    
+    // Initialize quotient and remainder
+    precn_zero(quotient);
+    precn_zero(remainder);
     
     // Long division algorithm - process bit by bit
     for (int i = dividend->siz * 32 - 1; i >= 0; i--) {
@@ -228,7 +820,7 @@ int precn_divmod(precn_t quotient, precn_t remainder, const precn_t dividend, co
 }
 
 // Simple division: quotient = dividend / divisor
-int precn_div(precn_t quotient, const precn_t dividend, const precn_t divisor) {
+int precn_div(precn_t quotient, precn_srcptr dividend, precn_srcptr divisor) {
     precn_t temp_remainder = precn_new(dividend->siz);
     int result = precn_divmod(quotient, temp_remainder, dividend, divisor);
     precn_free(temp_remainder);
@@ -236,15 +828,99 @@ int precn_div(precn_t quotient, const precn_t dividend, const precn_t divisor) {
 }
 
 // Modulo: remainder = dividend % divisor
-int precn_mod(precn_t remainder, const precn_t dividend, const precn_t divisor) {
+int precn_mod(precn_t remainder, precn_srcptr dividend, precn_srcptr divisor) {
     precn_t temp_quotient = precn_new(dividend->siz);
     int result = precn_divmod(temp_quotient, remainder, dividend, divisor);
     precn_free(temp_quotient);
     return result;
 }
 
+// In-place remainder: u = u % d, for d of at least three words.
+// Word-level long division (Knuth D) with 3/2 quotient estimates; quotient
+// words are used only to subtract and are never stored.
+// u needs one spare limb beyond u->siz for the normalizing shift.
+static void precn_rem_inplace(precn_t u, precn_srcptr d) {
+    int un = u->siz, dn = d->siz;
+    if (un < dn) {
+        return;
+    }
+    int s = precn_clz32(d->a[dn - 1]);
+    uint32_t *dv = (uint32_t*)malloc(dn * sizeof(uint32_t));
+    uint32_t *uv = u->a;
+    for (int i = dn - 1; i >= 0; i--) {
+        dv[i] = s ? (d->a[i] << s) | (i > 0 ? d->a[i - 1] >> (32 - s) : 0) : d->a[i];
+    }
+    uv[un] = s ? uv[un - 1] >> (32 - s) : 0;
+    for (int i = un - 1; i >= 0; i--) {
+        uv[i] = s ? (uv[i] << s) | (i > 0 ? uv[i - 1] >> (32 - s) : 0) : uv[i];
+    }
+    
+    uint32_t d1 = dv[dn - 1], d0 = dv[dn - 2];
+    uint64_t dtop = ((uint64_t)d1 << 32) | d0;
+    uint32_t v = precn_reciprocal_3by2(d1, d0);
+    for (int j = un - dn; j >= 0; j--) {
+        uint32_t u2 = uv[j + dn], u1 = uv[j + dn - 1], u0 = uv[j + dn - 2];
+        uint32_t q;
+        if (u2 == d1 && u1 == d0) {
+            q = 0xFFFFFFFF;
+        } else {
+            uint64_t r;
+            q = precn_div_3by2(&r, u2, u1, u0, dtop, v);
+        }
+        
+        // u[j..j+dn] -= q * d
+        uint64_t borrow = 0;
+        for (int i = 0; i < dn; i++) {
+            uint64_t t = (uint64_t)q * dv[i] + borrow;
+            uint32_t lo = (uint32_t)t;
+            borrow = (t >> 32) + (uv[j + i] < lo);
+            uv[j + i] -= lo;
+        }
+        uint32_t top = uv[j + dn];
+        uv[j + dn] = top - (uint32_t)borrow;
+        
+        // The estimate can be one too large: add d back while negative
+        int negative = top < borrow;
+        while (negative) {
+            uint32_t carry = precn_limbs_add(uv + j, uv + j, dn, dv, dn);
+            uv[j + dn] += carry;
+            negative = !(carry && uv[j + dn] == 0);
+        }
+    }
+    
+    for (int i = 0; i < dn; i++) {
+        uv[i] = s ? (uv[i] >> s) | (uv[i + 1] << (32 - s)) : uv[i];
+    }
+    free(dv);
+    u->siz = dn;
+    precn_normalize(u);
+}
+
+// Modular multiplication: res = (a * b) % m
+// The product is formed in one scratch buffer and reduced there in place;
+// no quotient is allocated or kept.
+// Returns 0 on success, -1 if m is zero
+int precn_mulmod(precn_t res, precn_srcptr a, precn_srcptr b, precn_srcptr m) {
+    if (m->siz == 0) {
+        return -1;
+    }
+    precn_t prod = precn_new(a->siz + b->siz + 1);
+    precn_mul(prod, a, b);
+    if (m->siz <= 2) {
+        uint64_t d = precn_get_u64(m);
+        uint64_t r;
+        precn_divmod_u64(NULL, &r, prod, d);
+        precn_set_u64(res, r);
+    } else {
+        precn_rem_inplace(prod, m);
+        precn_copy(res, prod);
+    }
+    precn_free(prod);
+    return 0;
+}
+
 // Left shift by n bits: res = a << n
-void precn_shl(precn_t res, const precn_t a, int n) {
+void precn_shl(precn_t res, precn_srcptr a, int n) {
     if (n == 0) {
         precn_copy(res, a);
         return;
@@ -283,14 +959,9 @@ void precn_shl(precn_t res, const precn_t a, int n) {
     res->siz = new_size;
     precn_normalize(res);
 }
-/*
 // Right shift by n bits: res = a >> n
-void precn_shr(precn_t res, const precn_t a, int n) {
-    if (n == 0) {
-        precn_copy(res, a);
-        return;
-    }
-    
+// res may alias a
+void precn_shr(precn_t res, precn_srcptr a, int n) {
     int word_shift = n / 32;
     int bit_shift = n % 32;
     
@@ -305,27 +976,149 @@ void precn_shr(precn_t res, const precn_t a, int n) {
         res->alloc_size = new_size;
     }
     
-    if (bit_shift == 0) {
-        // Simple word shift
-        for (int i = 0; i < new_size; i++) {
-            res->a[i] = a->a[i + word_shift];
-        }
-    } else {
-        // Bit shift with borrow
-        uint32_t borrow = 0;
-        for (int i = new_size - 1; i >= 0; i--) {
-            uint64_t temp = ((uint64_t)borrow << 32) | a->a[i + word_shift];
-            res->a[i] = (uint32_t)(temp >> bit_shift);
-            borrow = a->a[i + word_shift];
-        }
+    // Ascending order only reads words at or above the one being written
+    for (int i = 0; i < new_size; i++) {
+        uint32_t lo = a->a[i + word_shift];
+        uint32_t hi = i + 1 < new_size ? a->a[i + word_shift + 1] : 0;
+        res->a[i] = bit_shift ? (lo >> bit_shift) | (hi << (32 - bit_shift)) : lo;
     }
     
     res->siz = new_size;
     precn_normalize(res);
 }
-*/
+
+// Number of trailing zero bits of a nonzero n
+static int precn_trailing_zeros(precn_srcptr n) {
+    int i = 0;
+    while (n->a[i] == 0) {
+        i++;
+    }
+    int bits = 0;
+    uint32_t w = n->a[i];
+    while ((w & 1) == 0) {
+        w >>= 1;
+        bits++;
+    }
+    return i * 32 + bits;
+}
+
+// Inverse of odd d modulo 2^32 by Newton iteration; each step doubles the
+// number of correct low bits, starting from 3
+static uint32_t precn_inverse_u32(uint32_t d) {
+    uint32_t inv = d;
+    for (int i = 0; i < 4; i++) {
+        inv *= 2 - d * inv;
+    }
+    return inv;
+}
+
+// Hensel (2-adic) division of a by odd d, low limbs first: each step picks
+// the quotient word that clears the lowest remaining word of a, so no
+// quotient estimate or correction is needed. a is overwritten with
+// a - q * d and q receives a->siz - d->siz + 1 words. Returns 1 when the
+// division was exact, i.e. nothing but zero is left in a.
+static int precn_hensel_div(precn_t q, precn_t a, precn_srcptr d) {
+    int n = a->siz, m = d->siz;
+    int qn = n - m + 1;
+    uint32_t d0 = d->a[0];
+    uint32_t dinv = precn_inverse_u32(d0);
+    if (q) {
+        precn_reserve_quotient(q, qn);
+    }
+
+    uint32_t borrow_out = 0;
+    for (int i = 0; i < qn; i++) {
+        uint32_t qi = a->a[i] * dinv;
+        uint64_t borrow = 0;
+        int lim = m < n - i ? m : n - i;
+        for (int j = 0; j < lim; j++) {
+            uint64_t t = (uint64_t)qi * d->a[j] + borrow;
+            uint32_t lo = (uint32_t)t;
+            borrow = (t >> 32) + (a->a[i + j] < lo);
+            a->a[i + j] -= lo;
+        }
+        for (int j = i + lim; borrow && j < n; j++) {
+            uint32_t w = a->a[j];
+            a->a[j] = w - (uint32_t)borrow;
+            borrow = w < borrow;
+        }
+        borrow_out |= (uint32_t)borrow;
+        if (q) {
+            q->a[i] = qi;
+        }
+    }
+    if (q) {
+        q->siz = qn;
+        precn_normalize(q);
+    }
+    precn_normalize(a);
+    return !borrow_out && a->siz == 0;
+}
+
+// Exact division: quotient = dividend / divisor, for divisor known to divide
+// dividend. Much cheaper than precn_divmod since no remainder is formed;
+// the quotient is meaningless if the division is not exact.
+// Returns 0 on success, -1 if divisor is zero
+int precn_divexact(precn_t quotient, precn_srcptr dividend, precn_srcptr divisor) {
+    if (divisor->siz == 0) {
+        return -1;
+    }
+    if (dividend->siz < divisor->siz) {
+        precn_zero(quotient);
+        return 0;
+    }
+    if (divisor->siz == 1) {
+        return precn_divmod_u32(quotient, NULL, dividend, divisor->a[0]);
+    }
+    int tz = precn_trailing_zeros(divisor);
+    precn_t a = precn_new(dividend->siz);
+    precn_t d = precn_new(divisor->siz);
+    precn_shr(a, dividend, tz);
+    precn_shr(d, divisor, tz);
+    if (a->siz < d->siz) {
+        precn_zero(quotient);
+    } else {
+        precn_hensel_div(quotient, a, d);
+    }
+    precn_free(a);
+    precn_free(d);
+    return 0;
+}
+
+// Divisibility test: returns 1 if divisor divides dividend, 0 if not,
+// -1 if divisor is zero
+int precn_divisible(precn_srcptr dividend, precn_srcptr divisor) {
+    if (divisor->siz == 0) {
+        return -1;
+    }
+    if (dividend->siz == 0) {
+        return 1;
+    }
+    if (dividend->siz < divisor->siz) {
+        return 0;
+    }
+    if (divisor->siz <= 2) {
+        uint64_t d = precn_get_u64(divisor);
+        uint64_t r;
+        precn_divmod_u64(NULL, &r, dividend, d);
+        return r == 0;
+    }
+    int tz = precn_trailing_zeros(divisor);
+    if (precn_trailing_zeros(dividend) < tz) {
+        return 0;
+    }
+    precn_t a = precn_new(dividend->siz);
+    precn_t d = precn_new(divisor->siz);
+    precn_shr(a, dividend, tz);
+    precn_shr(d, divisor, tz);
+    int result = a->siz >= d->siz && precn_hensel_div(NULL, a, d);
+    precn_free(a);
+    precn_free(d);
+    return result;
+}
+
 // Print as hex (for debugging)
-void precn_print_hex(const precn_t n) {
+void precn_print_hex(precn_srcptr n) {
     if (n->siz == 0) {
         printf("0x0\n");
         return;
@@ -337,4 +1130,778 @@ void precn_print_hex(const precn_t n) {
     printf("\n");
 }
 
+// Powers, factorials and binomial coefficients
+// All three reduce to products of many small factors. The factors are
+// packed into words and multiplied as a balanced binary tree, so the big
+// multiplications are between operands of similar size.
+
+#define PRECN_BIN_SIEVE_FRACTION 8 // precn_bin_ui sieves once k >= n / 8
+
+// res = product of the words f[lo..hi), multiplied as a balanced tree
+static void precn_tree_product(precn_t res, const uint32_t *f, int lo, int hi) {
+    if (hi - lo <= 16) {
+        precn_set_u32(res, 1);
+        for (int i = lo; i < hi; i++) {
+            precn_mul_u64(res, res, f[i]);
+        }
+        return;
+    }
+    int mid = lo + (hi - lo) / 2;
+    precn_t left = precn_new(mid - lo);
+    precn_t right = precn_new(hi - mid);
+    precn_tree_product(left, f, lo, mid);
+    precn_tree_product(right, f, mid, hi);
+    precn_mul(res, left, right);
+    precn_free(left);
+    precn_free(right);
+}
+
+// res = product of the odd parts of lo+1, ..., hi; returns the number of
+// factors of two removed
+static unsigned long precn_odd_range_product(precn_t res, unsigned long lo, unsigned long hi) {
+    unsigned long twos = 0;
+    uint32_t *f = (uint32_t*)malloc((hi - lo + 1) * sizeof(uint32_t));
+    int count = 0;
+    uint64_t acc = 1;
+    for (unsigned long k = lo + 1; k <= hi; k++) {
+        unsigned long odd = k;
+        while ((odd & 1) == 0) {
+            odd >>= 1;
+            twos++;
+        }
+        if (acc * odd > 0xFFFFFFFF) {
+            f[count++] = (uint32_t)acc;
+            acc = 1;
+        }
+        acc *= odd;
+    }
+    f[count++] = (uint32_t)acc;
+    precn_tree_product(res, f, 0, count);
+    free(f);
+    return twos;
+}
+
+// Integer power: res = a^k
+// Left-to-right sliding window over the bits of k: one precn_sqr per bit
+// and one multiply per window, using a table of odd powers of a. The window
+// widens from 1 to 5 bits with the bit length of k.
+// res may alias a
+void precn_pow_ui(precn_t res, precn_srcptr a, unsigned long k) {
+    if (k == 0) {
+        precn_set_u32(res, 1);
+        return;
+    }
+    int bits = 0;
+    while (bits < (int)(8 * sizeof(k)) && (k >> bits) != 0) {
+        bits++;
+    }
+    int w = bits > 48 ? 5 : (bits > 24 ? 4 : (bits > 6 ? 3 : 1));
+    
+    // table[i] = a^(2i+1)
+    int tsize = 1 << (w - 1);
+    precn_t *table = (precn_t*)malloc(tsize * sizeof(precn_t));
+    table[0] = precn_new(a->siz);
+    precn_copy(table[0], a);
+    precn_t acc = precn_new(2 * a->siz);
+    precn_t tmp = precn_new(2 * a->siz);
+    if (tsize > 1) {
+        precn_sqr(acc, a);
+    }
+    for (int i = 1; i < tsize; i++) {
+        table[i] = precn_new(1);
+        precn_mul(table[i], table[i - 1], acc);
+    }
+    
+    precn_set_u32(acc, 1);
+    int started = 0;
+    for (int i = bits - 1; i >= 0; ) {
+        if (((k >> i) & 1) == 0) {
+            if (started) {
+                precn_sqr(tmp, acc);
+                struct __precn_struct t = *acc; *acc = *tmp; *tmp = t;
+            }
+            i--;
+            continue;
+        }
+        // Longest window of at most w bits starting at bit i and ending in a 1
+        int j = i - w + 1 > 0 ? i - w + 1 : 0;
+        while (((k >> j) & 1) == 0) {
+            j++;
+        }
+        unsigned long window = (k >> j) & ((1UL << (i - j + 1)) - 1);
+        if (started) {
+            for (int b = 0; b < i - j + 1; b++) {
+                precn_sqr(tmp, acc);
+                struct __precn_struct t = *acc; *acc = *tmp; *tmp = t;
+            }
+            precn_mul(tmp, acc, table[window >> 1]);
+            struct __precn_struct t = *acc; *acc = *tmp; *tmp = t;
+        } else {
+            precn_copy(acc, table[window >> 1]);
+            started = 1;
+        }
+        i = j - 1;
+    }
+    
+    // Hand acc's buffer to res
+    struct __precn_struct t = *res; *res = *acc; *acc = t;
+    for (int i = 0; i < tsize; i++) {
+        precn_free(table[i]);
+    }
+    free(table);
+    precn_free(acc);
+    precn_free(tmp);
+}
+
+// Factorial: res = n!
+// The odd parts of 1..n are multiplied as a balanced tree and the
+// n - popcount(n) factors of two are applied with a single shift.
+void precn_fac_ui(precn_t res, unsigned long n) {
+    precn_t odd = precn_new(1);
+    unsigned long twos = precn_odd_range_product(odd, 0, n);
+    precn_shl(res, odd, (int)twos);
+    precn_free(odd);
+}
+
+// Binomial coefficient from its prime factorization, for k <= n - k:
+// by Legendre's formula each prime p <= n appears to the power
+//   sum over i of floor(n/p^i) - floor(k/p^i) - floor((n-k)/p^i)
+// which is at most log_p(n) (Kummer), so each prime power fits in a word.
+// The odd prime powers are packed into words for a tree product and the
+// factors of two are applied with one shift.
+static void precn_bin_sieve(precn_t res, unsigned long n, unsigned long k) {
+    unsigned long twos = 0;
+    for (unsigned long d = 2; d <= n; d *= 2) {
+        twos += n / d - k / d - (n - k) / d;
+        if (d > n / 2) {
+            break;
+        }
+    }
+
+    // Sieve of Eratosthenes over the odd numbers up to n, counting the primes
+    uint8_t *composite = (uint8_t*)calloc(n / 2 + 1, 1);
+    unsigned long primes = 0;
+    for (unsigned long p = 3; p <= n; p += 2) {
+        if (composite[p / 2]) {
+            continue;
+        }
+        primes++;
+        if (p <= n / p) {
+            for (unsigned long q = p * p; q <= n; q += 2 * p) {
+                composite[q / 2] = 1;
+            }
+        }
+    }
+
+    // At most one word per odd prime
+    uint32_t *f = (uint32_t*)malloc((primes + 1) * sizeof(uint32_t));
+    int count = 0;
+    uint64_t acc = 1;
+    for (unsigned long p = 3; p <= n; p += 2) {
+        if (composite[p / 2]) {
+            continue;
+        }
+        uint64_t pe = 1;
+        for (unsigned long d = p; d <= n; d *= p) {
+            if (n / d - k / d - (n - k) / d) {
+                pe *= p;
+            }
+            if (d > n / p) {
+                break;
+            }
+        }
+        if (acc * pe > 0xFFFFFFFF) {
+            f[count++] = (uint32_t)acc;
+            acc = 1;
+        }
+        acc *= pe;
+    }
+    f[count++] = (uint32_t)acc;
+    free(composite);
+
+    precn_t odd = precn_new(1);
+    precn_tree_product(odd, f, 0, count);
+    precn_shl(res, odd, (int)twos);
+    free(f);
+    precn_free(odd);
+}
+
+// Binomial coefficient: res = n choose k
+// When k is a large fraction of n, the prime factorization (precn_bin_sieve)
+// avoids dividing two huge products. Otherwise the sieve's O(n) time and
+// memory would dominate, so the odd parts of n-k+1..n and of 1..k are tree
+// products instead; the first is exactly divisible by the second, which is
+// short, so precn_divexact is cheap.
+void precn_bin_ui(precn_t res, unsigned long n, unsigned long k) {
+    if (k > n) {
+        precn_zero(res);
+        return;
+    }
+    if (k > n - k) {
+        k = n - k;
+    }
+    if (k >= n / PRECN_BIN_SIEVE_FRACTION) {
+        precn_bin_sieve(res, n, k);
+        return;
+    }
+    precn_t num = precn_new(1);
+    precn_t den = precn_new(1);
+    precn_t quot = precn_new(1);
+    unsigned long twos = precn_odd_range_product(num, n - k, n);
+    twos -= precn_odd_range_product(den, 0, k);
+    precn_divexact(quot, num, den);
+    precn_shl(res, quot, (int)twos);
+    precn_free(num);
+    precn_free(den);
+    precn_free(quot);
+}
+
+// Binary format: 16-byte header followed by the limbs, least significant first.
+//   bytes 0-3   magic "PRCN"
+//   byte  4     format version (PRECN_FORMAT_VERSION)
+//   byte  5     limb size in bytes (always 4)
+//   byte  6     limb byte order (0 = little endian)
+//   byte  7     reserved, zero
+//   bytes 8-15  limb count, little endian uint64
+// The header keeps the limb data 16-byte aligned so a file can be mapped and
+// used in place.
+#define PRECN_FORMAT_VERSION 1
+#define PRECN_HEADER_SIZE 16
+#define PRECN_IO_CHUNK (1 << 24) // bytes per read/write call
+
+static int precn_host_is_le(void) {
+    uint32_t one = 1;
+    return *(uint8_t*)&one == 1;
+}
+
+static void precn_bswap_limbs(uint32_t *dst, const uint32_t *src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t v = src[i];
+        dst[i] = (v >> 24) | ((v >> 8) & 0xFF00) | ((v << 8) & 0xFF0000) | (v << 24);
+    }
+}
+
+// Read or write exactly len bytes, retrying on short transfers
+static int precn_io_full(int fd, void *buf, size_t len, int writing) {
+    uint8_t *p = (uint8_t*)buf;
+    while (len > 0) {
+        size_t chunk = len < PRECN_IO_CHUNK ? len : PRECN_IO_CHUNK;
+#ifdef _WIN32
+        int done = writing ? _write(fd, p, (unsigned)chunk) : _read(fd, p, (unsigned)chunk);
+#else
+        ssize_t done = writing ? write(fd, p, chunk) : read(fd, p, chunk);
+#endif
+        if (done <= 0) {
+            return -1;
+        }
+        p += done;
+        len -= (size_t)done;
+    }
+    return 0;
+}
+
+static void precn_encode_header(uint8_t *h, uint64_t count) {
+    memcpy(h, "PRCN", 4);
+    h[4] = PRECN_FORMAT_VERSION;
+    h[5] = sizeof(uint32_t);
+    h[6] = 0;
+    h[7] = 0;
+    for (int i = 0; i < 8; i++) {
+        h[8 + i] = (uint8_t)(count >> (8 * i));
+    }
+}
+
+// Returns the limb count, or -1 if the header is not a valid version 1 header
+static int precn_decode_header(const uint8_t *h) {
+    if (memcmp(h, "PRCN", 4) != 0 || h[4] != PRECN_FORMAT_VERSION ||
+        h[5] != sizeof(uint32_t) || h[6] != 0) {
+        return -1;
+    }
+    uint64_t count = 0;
+    for (int i = 0; i < 8; i++) {
+        count |= (uint64_t)h[8 + i] << (8 * i);
+    }
+    return count > INT_MAX ? -1 : (int)count;
+}
+
+// Write count limbs to fd in little endian order
+static int precn_write_limbs(int fd, const uint32_t *limbs, size_t count) {
+    if (precn_host_is_le()) {
+        return precn_io_full(fd, (void*)limbs, count * sizeof(uint32_t), 1);
+    }
+
+    // Big endian host: swap through a bounded staging buffer
+    size_t buf_limbs = PRECN_IO_CHUNK / sizeof(uint32_t);
+    uint32_t *buf = (uint32_t*)malloc(PRECN_IO_CHUNK);
+    if (!buf) {
+        return -1;
+    }
+    int result = 0;
+    for (size_t done = 0; done < count && result == 0; done += buf_limbs) {
+        size_t chunk = count - done < buf_limbs ? count - done : buf_limbs;
+        precn_bswap_limbs(buf, limbs + done, chunk);
+        result = precn_io_full(fd, buf, chunk * sizeof(uint32_t), 1);
+    }
+    free(buf);
+    return result;
+}
+
+// Write n to fd in the binary format (open fd in binary mode on Windows)
+// Returns 0 on success, -1 on I/O error
+int precn_write(int fd, precn_srcptr n) {
+    uint8_t header[PRECN_HEADER_SIZE];
+    precn_encode_header(header, (uint64_t)n->siz);
+    if (precn_io_full(fd, header, sizeof(header), 1) != 0) {
+        return -1;
+    }
+    return precn_write_limbs(fd, n->a, (size_t)n->siz);
+}
+
+// Read a number written by precn_write from fd into n, growing n as needed
+// Returns 0 on success, -1 on I/O error or malformed header
+int precn_read(precn_t n, int fd) {
+    uint8_t header[PRECN_HEADER_SIZE];
+    if (precn_io_full(fd, header, sizeof(header), 0) != 0) {
+        return -1;
+    }
+    int count = precn_decode_header(header);
+    if (count < 0) {
+        return -1;
+    }
+    if (n->alloc_size < count) {
+        uint32_t *grown = (uint32_t*)realloc(n->a, count * sizeof(uint32_t));
+        if (!grown) {
+            return -1;
+        }
+        n->a = grown;
+        n->alloc_size = count;
+    }
+    if (precn_io_full(fd, n->a, (size_t)count * sizeof(uint32_t), 0) != 0) {
+        precn_zero(n);
+        return -1;
+    }
+    if (!precn_host_is_le()) {
+        precn_bswap_limbs(n->a, n->a, count);
+    }
+    memset(n->a + count, 0, (n->alloc_size - count) * sizeof(uint32_t));
+    n->siz = count;
+    precn_normalize(n);
+    return 0;
+}
+
+// A mapped number: the view handed out is the first member, so
+// precn_unmap can recover the mapping from it
+struct __precn_map {
+    struct __precn_struct n;
+    void *base;
+    size_t len;
+#ifdef _WIN32
+    HANDLE mapping;
+#endif
+};
+
+// Release a view returned by precn_map
+void precn_unmap(precn_srcptr view) {
+    if (!view) {
+        return;
+    }
+    struct __precn_map *m = (struct __precn_map*)view;
+#ifdef _WIN32
+    UnmapViewOfFile(m->base);
+    CloseHandle(m->mapping);
+#else
+    munmap(m->base, m->len);
+#endif
+    free(m);
+}
+
+// Map the number stored at the start of fd (as written by precn_write) and
+// return a read-only view whose limbs point directly into the mapping.
+// Nothing is copied; pages are faulted in on first access.
+// The view is a precn_srcptr, so it can only be passed as a const operand;
+// release it with precn_unmap, never precn_free. fd may be closed once the
+// view exists.
+// Returns NULL on error, on a malformed header, or on a big endian host
+// (where the little endian limbs cannot be used in place).
+precn_srcptr precn_map(int fd) {
+    if (!precn_host_is_le()) {
+        return NULL;
+    }
+    struct __precn_map *m = (struct __precn_map*)calloc(1, sizeof(struct __precn_map));
+    if (!m) {
+        return NULL;
+    }
+#ifdef _WIN32
+    HANDLE file = (HANDLE)_get_osfhandle(fd);
+    LARGE_INTEGER file_size;
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &file_size) ||
+        file_size.QuadPart < PRECN_HEADER_SIZE) {
+        free(m);
+        return NULL;
+    }
+    m->len = (size_t)file_size.QuadPart;
+    m->mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    m->base = m->mapping ? MapViewOfFile(m->mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!m->base) {
+        if (m->mapping) CloseHandle(m->mapping);
+        free(m);
+        return NULL;
+    }
+#else
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < PRECN_HEADER_SIZE) {
+        free(m);
+        return NULL;
+    }
+    m->len = (size_t)st.st_size;
+    m->base = mmap(NULL, m->len, PROT_READ, MAP_SHARED, fd, 0);
+    if (m->base == MAP_FAILED) {
+        free(m);
+        return NULL;
+    }
+#endif
+    int count = precn_decode_header((const uint8_t*)m->base);
+    if (count < 0 || (size_t)count > (m->len - PRECN_HEADER_SIZE) / sizeof(uint32_t)) {
+        m->n.a = NULL;
+        precn_unmap(&m->n);
+        return NULL;
+    }
+    m->n.a = (uint32_t*)((uint8_t*)m->base + PRECN_HEADER_SIZE);
+    m->n.siz = count;
+    m->n.alloc_size = count;
+    precn_normalize(&m->n);
+    return &m->n;
+}
+
+// Out-of-core multiplication: write a * b to fd in the binary format
+// without holding the operands or the product in malloc'd memory.
+// a and b are normally views from precn_map, so their limbs are paged in from
+// disk on demand. Both are cut into blocks of K limbs and the block products
+// a_i * b_j are summed one anti-diagonal (i + j = s) at a time; once diagonal
+// s is done the low K limbs of the accumulator are final and are appended to
+// fd, so the product is written strictly sequentially.
+// mem_budget bounds the heap working set in bytes: the block product (2K
+// limbs), the accumulator (2K) and precn_mul's Karatsuba scratch (about 4K
+// summed down the recursion), about 8K limbs in total. The two operand blocks
+// (2K limbs) are mapped pages on top of that, which the kernel may evict.
+// The header records n + m limbs; a zero top limb is dropped on load.
+// Returns 0 on success, -1 on allocation or I/O error
+int precn_mul_file(int fd, precn_srcptr a, precn_srcptr b, size_t mem_budget) {
+    int n = a->siz, m = b->siz;
+    size_t total = (n == 0 || m == 0) ? 0 : (size_t)n + m;
+    uint8_t header[PRECN_HEADER_SIZE];
+    precn_encode_header(header, total);
+    if (precn_io_full(fd, header, sizeof(header), 1) != 0) {
+        return -1;
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    size_t k_limit = mem_budget / (8 * sizeof(uint32_t));
+    int K = k_limit < 64 ? 64 : (k_limit > INT_MAX / 4 ? INT_MAX / 4 : (int)k_limit);
+    if (K > (n > m ? n : m)) {
+        K = n > m ? n : m; // a bigger block than the operands only wastes memory
+    }
+    int na = (n + K - 1) / K, nb = (m + K - 1) / K;
+    int acc_size = 2 * K + 2;
+    uint32_t *acc = (uint32_t*)calloc(acc_size, sizeof(uint32_t));
+    precn_t prod = precn_new(2 * K);
+    if (!acc || !prod->a) {
+        free(acc);
+        precn_free(prod);
+        return -1;
+    }
+
+    int result = 0;
+    size_t pos = 0;
+    for (int s = 0; s <= na + nb - 2 && result == 0; s++) {
+        int i_lo = s - nb + 1 > 0 ? s - nb + 1 : 0;
+        int i_hi = s < na - 1 ? s : na - 1;
+        for (int i = i_lo; i <= i_hi; i++) {
+            int j = s - i;
+            struct __precn_struct ab, bb;
+            ab.a = a->a + (size_t)i * K;
+            ab.siz = ab.alloc_size = (i == na - 1) ? n - i * K : K;
+            bb.a = b->a + (size_t)j * K;
+            bb.siz = bb.alloc_size = (j == nb - 1) ? m - j * K : K;
+            precn_mul(prod, &ab, &bb);
+
+            uint64_t carry = 0;
+            int t;
+            for (t = 0; t < prod->siz; t++) {
+                uint64_t sum = (uint64_t)acc[t] + prod->a[t] + carry;
+                acc[t] = (uint32_t)sum;
+                carry = sum >> 32;
+            }
+            for (; carry && t < acc_size; t++) {
+                uint64_t sum = (uint64_t)acc[t] + carry;
+                acc[t] = (uint32_t)sum;
+                carry = sum >> 32;
+            }
+        }
+
+        // Low K limbs are final: emit them and shift the accumulator down
+        size_t emit = total - pos < (size_t)K ? total - pos : (size_t)K;
+        result = precn_write_limbs(fd, acc, emit);
+        pos += emit;
+        memmove(acc, acc + K, (acc_size - K) * sizeof(uint32_t));
+        memset(acc + acc_size - K, 0, K * sizeof(uint32_t));
+    }
+    if (result == 0 && pos < total) {
+        result = precn_write_limbs(fd, acc, total - pos);
+    }
+
+    free(acc);
+    precn_free(prod);
+    return result;
+}
+
+// Residue number system (RNS)
+// A value is held as its residues modulo k primes p_0..p_{k-1} just below
+// 2^31, i.e. modulo M = p_0 * ... * p_{k-1}. Addition, subtraction and
+// multiplication act on each residue independently with no carries between
+// lanes, so long chains of them are cheap; the value is converted back with
+// Garner's mixed-radix CRT only when needed.
+// Results are exact as long as the true value stays in [0, M); subtraction
+// wraps modulo M, so a chain may go negative in the middle but must end
+// non-negative. Size the context for the largest value in the chain.
+// Residues are kept in Montgomery form (r * 2^32 mod p), so a lane multiply
+// is one 32x32->64 product plus a multiply-based reduction with no divide;
+// the lane loops have no branches and vectorize. With OpenMP, lanes are also
+// split across threads once there is enough work to pay for the fork.
+#define PRECN_RNS_OMP_THRESHOLD (1 << 16) // lanes
+
+#ifdef _OPENMP
+#define PRECN_RNS_PRAGMA(x) _Pragma(#x)
+#define PRECN_RNS_LANES(work) PRECN_RNS_PRAGMA(omp parallel for simd schedule(static) if((work) >= PRECN_RNS_OMP_THRESHOLD))
+#else
+#define PRECN_RNS_LANES(work)
+#endif
+
+struct __precn_rns_ctx {
+    int k;              // number of primes
+    uint32_t *p;        // primes, each in (2^30, 2^31)
+    uint32_t *pinv;     // -p_i^-1 mod 2^32, for Montgomery reduction
+    uint32_t *r2;       // 2^64 mod p_i
+    uint32_t *c;        // Garner constants (p_0 * ... * p_{i-1})^-1 mod p_i
+};
+typedef struct __precn_rns_ctx *precn_rns_ctx_t;
+
+struct __precn_rns {
+    precn_rns_ctx_t ctx;
+    uint32_t *r;        // r[i] = value * 2^32 mod p_i
+};
+typedef struct __precn_rns *precn_rns_t;
+typedef const struct __precn_rns *precn_rns_srcptr;
+
+static uint32_t precn_rns_mulmod(uint32_t a, uint32_t b, uint32_t p) {
+    return (uint32_t)((uint64_t)a * b % p);
+}
+
+static uint32_t precn_rns_powmod(uint32_t a, uint32_t e, uint32_t p) {
+    uint32_t r = 1;
+    while (e) {
+        if (e & 1) r = precn_rns_mulmod(r, a, p);
+        a = precn_rns_mulmod(a, a, p);
+        e >>= 1;
+    }
+    return r;
+}
+
+// Montgomery reduction: t * 2^-32 mod p, for t < 2^32 p
+static inline uint32_t precn_rns_redc(uint64_t t, uint32_t p, uint32_t pinv) {
+    uint32_t m = (uint32_t)t * pinv;
+    uint32_t u = (uint32_t)((t + (uint64_t)m * p) >> 32);
+    return u >= p ? u - p : u;
+}
+
+// Deterministic Miller-Rabin for 32-bit n (bases 2, 7, 61)
+static int precn_rns_is_prime(uint32_t n) {
+    static const uint32_t bases[] = { 2, 7, 61 };
+    uint32_t d = n - 1;
+    int s = 0;
+    while ((d & 1) == 0) {
+        d >>= 1;
+        s++;
+    }
+    for (int i = 0; i < 3; i++) {
+        uint32_t x = precn_rns_powmod(bases[i] % n, d, n);
+        if (x == 0 || x == 1 || x == n - 1) continue;
+        int composite = 1;
+        for (int j = 1; j < s && composite; j++) {
+            x = precn_rns_mulmod(x, x, n);
+            if (x == n - 1) composite = 0;
+        }
+        if (composite) return 0;
+    }
+    return 1;
+}
+
+// Create a context whose modulus M exceeds 2^bits
+// Takes O(k) memory; the Garner constants cost O(k^2) word operations.
+precn_rns_ctx_t precn_rns_ctx_new(int bits) {
+    precn_rns_ctx_t ctx = (precn_rns_ctx_t)malloc(sizeof(struct __precn_rns_ctx));
+    int k = (bits > 0 ? bits : 1) / 30 + 1; // each prime exceeds 2^30
+    ctx->k = k;
+    ctx->p = (uint32_t*)malloc(k * sizeof(uint32_t));
+    ctx->pinv = (uint32_t*)malloc(k * sizeof(uint32_t));
+    ctx->r2 = (uint32_t*)malloc(k * sizeof(uint32_t));
+    ctx->c = (uint32_t*)malloc(k * sizeof(uint32_t));
+
+    uint32_t candidate = 0x7FFFFFFF;
+    for (int i = 0; i < k; i++, candidate -= 2) {
+        while (!precn_rns_is_prime(candidate)) {
+            candidate -= 2;
+        }
+        uint32_t p = candidate;
+        ctx->p[i] = p;
+        ctx->pinv[i] = 0u - precn_inverse_u32(p);
+        uint32_t r1 = (uint32_t)(((uint64_t)1 << 32) % p);
+        ctx->r2[i] = precn_rns_mulmod(r1, r1, p);
+
+        uint32_t prefix = 1;
+        for (int j = 0; j < i; j++) {
+            prefix = precn_rns_mulmod(prefix, ctx->p[j] % p, p);
+        }
+        ctx->c[i] = precn_rns_powmod(prefix, p - 2, p);
+    }
+    return ctx;
+}
+
+void precn_rns_ctx_free(precn_rns_ctx_t ctx) {
+    if (ctx) {
+        free(ctx->p);
+        free(ctx->pinv);
+        free(ctx->r2);
+        free(ctx->c);
+        free(ctx);
+    }
+}
+
+// Allocate an RNS value (zero) in the given context
+precn_rns_t precn_rns_new(precn_rns_ctx_t ctx) {
+    precn_rns_t r = (precn_rns_t)malloc(sizeof(struct __precn_rns));
+    r->ctx = ctx;
+    r->r = (uint32_t*)calloc(ctx->k, sizeof(uint32_t));
+    return r;
+}
+
+void precn_rns_free(precn_rns_t r) {
+    if (r) {
+        free(r->r);
+        free(r);
+    }
+}
+
+// Convert a into residues: res = a mod M
+// Horner over the limbs from the top, all lanes per limb. The lane loop runs
+// once per limb, so it is only split across threads when k alone pays for
+// the fork; a per-limb fork sized by k * siz costs more than it saves.
+// x * 2^32 + limb in Montgomery form is REDC((x + limb) * 2^64), for x already
+// in Montgomery form
+void precn_rns_set(precn_rns_t res, precn_srcptr a) {
+    precn_rns_ctx_t ctx = res->ctx;
+    int k = ctx->k;
+    const uint32_t *p = ctx->p, *pinv = ctx->pinv, *r2 = ctx->r2;
+    uint32_t *r = res->r;
+    memset(r, 0, k * sizeof(uint32_t));
+    for (int j = a->siz - 1; j >= 0; j--) {
+        uint32_t limb = a->a[j];
+        PRECN_RNS_LANES(k)
+        for (int i = 0; i < k; i++) {
+            // limb < 2^32 < 4 p, so three conditional subtractions reduce it
+            uint32_t l = limb;
+            l = l >= p[i] ? l - p[i] : l;
+            l = l >= p[i] ? l - p[i] : l;
+            l = l >= p[i] ? l - p[i] : l;
+            uint64_t t = (uint64_t)(r[i] + l) * r2[i]; // < 2 p^2 < 2^32 p
+            r[i] = precn_rns_redc(t, p[i], pinv[i]);
+        }
+    }
+}
+
+// res = (a + b) mod M
+void precn_rns_add(precn_rns_t res, precn_rns_srcptr a, precn_rns_srcptr b) {
+    int k = res->ctx->k;
+    const uint32_t *p = res->ctx->p;
+    uint32_t *r = res->r;
+    const uint32_t *x = a->r, *y = b->r;
+    PRECN_RNS_LANES(k)
+    for (int i = 0; i < k; i++) {
+        uint32_t s = x[i] + y[i]; // < 2^32 since both are below 2^31
+        r[i] = s >= p[i] ? s - p[i] : s;
+    }
+}
+
+// res = (a - b) mod M
+void precn_rns_sub(precn_rns_t res, precn_rns_srcptr a, precn_rns_srcptr b) {
+    int k = res->ctx->k;
+    const uint32_t *p = res->ctx->p;
+    uint32_t *r = res->r;
+    const uint32_t *x = a->r, *y = b->r;
+    PRECN_RNS_LANES(k)
+    for (int i = 0; i < k; i++) {
+        uint32_t d = x[i] - y[i];
+        r[i] = x[i] < y[i] ? d + p[i] : d;
+    }
+}
+
+// res = (a * b) mod M
+void precn_rns_mul(precn_rns_t res, precn_rns_srcptr a, precn_rns_srcptr b) {
+    int k = res->ctx->k;
+    const uint32_t *p = res->ctx->p, *pinv = res->ctx->pinv;
+    uint32_t *r = res->r;
+    const uint32_t *x = a->r, *y = b->r;
+    PRECN_RNS_LANES(k)
+    for (int i = 0; i < k; i++) {
+        r[i] = precn_rns_redc((uint64_t)x[i] * y[i], p[i], pinv[i]);
+    }
+}
+
+// Reconstruct the value in [0, M) from its residues: res = a
+void precn_rns_get(precn_t res, precn_rns_srcptr a) {
+    precn_rns_ctx_t ctx = a->ctx;
+    int k = ctx->k;
+    const uint32_t *p = ctx->p;
+
+    // Garner: mixed-radix digits v with a = v_0 + p_0 (v_1 + p_1 (v_2 + ...)).
+    // Digit i is (a - known prefix) * c_i mod p_i, with the prefix
+    // v_0 + p_0 v_1 + ... + p_0...p_{i-2} v_{i-1} evaluated by Horner mod p_i.
+    uint32_t *v = (uint32_t*)malloc(k * sizeof(uint32_t));
+    for (int i = 0; i < k; i++) {
+        uint32_t pi = p[i];
+        uint64_t x = 0;
+        for (int j = i - 1; j >= 0; j--) {
+            x = (x * p[j] + v[j]) % pi;
+        }
+        uint32_t ai = precn_rns_redc(a->r[i], pi, ctx->pinv[i]);
+        uint32_t t = ai >= x ? ai - (uint32_t)x : ai + pi - (uint32_t)x;
+        v[i] = precn_rns_mulmod(t, ctx->c[i], pi);
+    }
+
+    // Evaluate the mixed-radix form by Horner: x = x * p_i + v_i
+    int sz = k + 1; // M < 2^(31k)
+    if (res->alloc_size < sz) {
+        res->a = (uint32_t*)realloc(res->a, sz * sizeof(uint32_t));
+        res->alloc_size = sz;
+    }
+    memset(res->a, 0, sz * sizeof(uint32_t));
+    int len = 0;
+    for (int i = k - 1; i >= 0; i--) {
+        uint64_t carry = v[i];
+        for (int j = 0; j < len; j++) {
+            uint64_t t = (uint64_t)res->a[j] * p[i] + carry;
+            res->a[j] = (uint32_t)t;
+            carry = t >> 32;
+        }
+        if (carry) {
+            res->a[len++] = (uint32_t)carry;
+        }
+    }
+    free(v);
+    res->siz = len;
+    precn_normalize(res);
+}
+
 // ...add more functions as needed...
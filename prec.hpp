@@ -0,0 +1,265 @@
+// C++ wrapper for the precn high-precision library
+//
+// precn::Int owns a precn_t and frees it on destruction. Moves steal the limb
+// buffer, so returning and storing values never copies limbs.
+//
+// Products are returned as lightweight expression objects instead of Ints,
+// so the common fused patterns run as a single library call:
+//   x = a * b + c;   copies c into x, then precn_addmul(x, a, b), which
+//                    accumulates into x with no product temporary for small
+//                    operands (large ones go through one scratch product)
+//   x += a * b;      precn_addmul(x, a, b)
+//   x = (a * b) % m; precn_mulmod(x, a, b, m), which forms a * b in one
+//                    scratch buffer and reduces it there in place; the
+//                    product is not interleaved with the reduction
+// Assigning into an existing Int reuses its buffer. Expression objects hold
+// references to their operands, so convert them to an Int right away rather
+// than storing them with auto.
+//
+// Like test.c, this header includes prec.c directly, so include it from one
+// translation unit only.
+#ifndef PREC_HPP
+#define PREC_HPP
+
+#include <stdexcept>
+#include <utility>
+
+#include "prec.c"
+
+namespace precn {
+
+class Int;
+
+// a * b, evaluated when converted to an Int or consumed by a fused operator
+struct MulExpr {
+    const Int &a, &b;
+};
+
+// a * b + c
+struct MulAddExpr {
+    const Int &a, &b, &c;
+};
+
+// (a * b) % m
+struct MulModExpr {
+    const Int &a, &b, &m;
+};
+
+class Int {
+public:
+    Int() : n_(precn_new(1)) {}
+
+    Int(uint32_t val) : n_(precn_new(1)) {
+        precn_set_u32(n_, val);
+    }
+
+    // Take ownership of an existing precn_t
+    static Int adopt(precn_t n) {
+        return Int(n, AdoptTag());
+    }
+
+    Int(const Int &other) : n_(precn_new(other.n_->siz)) {
+        precn_copy(n_, other.n_);
+    }
+
+    // The moved-from Int holds no buffer; it may only be assigned or destroyed
+    Int(Int &&other) noexcept : n_(other.n_) {
+        other.n_ = nullptr;
+    }
+
+    Int(const MulExpr &e) : n_(precn_new(e.a.size() + e.b.size())) {
+        precn_mul(n_, e.a.n_, e.b.n_);
+    }
+
+    Int(const MulAddExpr &e) : n_(precn_new(e.a.size() + e.b.size() + 1)) {
+        precn_copy(n_, e.c.n_);
+        precn_addmul(n_, e.a.n_, e.b.n_);
+    }
+
+    Int(const MulModExpr &e) : n_(precn_new(e.m.size() + 1)) {
+        check(precn_mulmod(n_, e.a.n_, e.b.n_, e.m.n_));
+    }
+
+    ~Int() {
+        precn_free(n_);
+    }
+
+    Int &operator=(const Int &other) {
+        if (this != &other) {
+            ensure();
+            precn_copy(n_, other.n_);
+        }
+        return *this;
+    }
+
+    Int &operator=(Int &&other) noexcept {
+        std::swap(n_, other.n_);
+        return *this;
+    }
+
+    Int &operator=(const MulExpr &e) {
+        if (aliases(e.a) || aliases(e.b)) {
+            return *this = Int(e);
+        }
+        ensure();
+        precn_mul(n_, e.a.n_, e.b.n_);
+        return *this;
+    }
+
+    Int &operator=(const MulAddExpr &e) {
+        if (aliases(e.a) || aliases(e.b)) {
+            return *this = Int(e);
+        }
+        ensure();
+        if (!aliases(e.c)) {
+            precn_copy(n_, e.c.n_);
+        }
+        precn_addmul(n_, e.a.n_, e.b.n_);
+        return *this;
+    }
+
+    Int &operator=(const MulModExpr &e) {
+        if (aliases(e.m)) {
+            return *this = Int(e);
+        }
+        ensure();
+        check(precn_mulmod(n_, e.a.n_, e.b.n_, e.m.n_));
+        return *this;
+    }
+
+    Int &operator+=(const Int &other) {
+        precn_add(n_, n_, other.n_);
+        return *this;
+    }
+
+    // |*this - other|, matching precn_sub
+    Int &operator-=(const Int &other) {
+        precn_sub(n_, n_, other.n_);
+        return *this;
+    }
+
+    Int &operator*=(const Int &other) {
+        return *this = MulExpr{*this, other};
+    }
+
+    Int &operator+=(const MulExpr &e) {
+        if (aliases(e.a) || aliases(e.b)) {
+            Int prod(e);
+            return *this += prod;
+        }
+        precn_addmul(n_, e.a.n_, e.b.n_);
+        return *this;
+    }
+
+    Int &operator/=(const Int &other) {
+        Int q = adopt(precn_new(size()));
+        check(precn_div(q.n_, n_, other.n_));
+        return *this = std::move(q);
+    }
+
+    Int &operator%=(const Int &other) {
+        Int r = adopt(precn_new(other.size() + 1));
+        check(precn_mod(r.n_, n_, other.n_));
+        return *this = std::move(r);
+    }
+
+    Int &operator<<=(int bits) {
+        Int r = adopt(precn_new(size() + bits / 32 + 1));
+        precn_shl(r.n_, n_, bits);
+        return *this = std::move(r);
+    }
+
+    int size() const { return n_->siz; }
+    bool is_zero() const { return n_->siz == 0; }
+
+    // Access to the underlying value for calling the C API directly; a const
+    // Int only hands out a read-only pointer
+    precn_t get() { return n_; }
+    precn_srcptr get() const { return n_; }
+
+    // Give up ownership of the underlying value
+    precn_t release() {
+        precn_t n = n_;
+        n_ = nullptr;
+        return n;
+    }
+
+    friend int compare(const Int &a, const Int &b) {
+        return precn_cmp(a.n_, b.n_);
+    }
+
+private:
+    precn_t n_;
+
+    struct AdoptTag {};
+    Int(precn_t n, AdoptTag) : n_(n) {}
+
+    // Give a moved-from Int a fresh buffer before writing into it
+    void ensure() {
+        if (!n_) {
+            n_ = precn_new(1);
+        }
+    }
+
+    bool aliases(const Int &other) const {
+        return this == &other;
+    }
+
+    static void check(int result) {
+        if (result != 0) {
+            throw std::domain_error("precn: division by zero");
+        }
+    }
+};
+
+inline MulExpr operator*(const Int &a, const Int &b) {
+    return MulExpr{a, b};
+}
+
+inline MulAddExpr operator+(const MulExpr &e, const Int &c) {
+    return MulAddExpr{e.a, e.b, c};
+}
+
+inline MulAddExpr operator+(const Int &c, const MulExpr &e) {
+    return MulAddExpr{e.a, e.b, c};
+}
+
+inline MulModExpr operator%(const MulExpr &e, const Int &m) {
+    return MulModExpr{e.a, e.b, m};
+}
+
+inline Int operator+(Int a, const Int &b) {
+    a += b;
+    return a;
+}
+
+inline Int operator-(Int a, const Int &b) {
+    a -= b;
+    return a;
+}
+
+inline Int operator/(Int a, const Int &b) {
+    a /= b;
+    return a;
+}
+
+inline Int operator%(Int a, const Int &b) {
+    a %= b;
+    return a;
+}
+
+inline Int operator<<(Int a, int bits) {
+    a <<= bits;
+    return a;
+}
+
+inline bool operator==(const Int &a, const Int &b) { return compare(a, b) == 0; }
+inline bool operator!=(const Int &a, const Int &b) { return compare(a, b) != 0; }
+inline bool operator<(const Int &a, const Int &b) { return compare(a, b) < 0; }
+inline bool operator<=(const Int &a, const Int &b) { return compare(a, b) <= 0; }
+inline bool operator>(const Int &a, const Int &b) { return compare(a, b) > 0; }
+inline bool operator>=(const Int &a, const Int &b) { return compare(a, b) >= 0; }
+
+} // namespace precn
+
+#endif // PREC_HPP
@@ -0,0 +1,289 @@
+// Fixed-width integers for crypto-sized values (256 to 4096 bits)
+//
+// precn::Fixed<Bits> keeps its limbs inline (stack storage, no allocation)
+// and has no size field: every operation works on all Bits / 32 limbs, so
+// there are no size checks or normalize loops. The inner limb loops are
+// expanded at compile time through unroll<>; outer loops have constant trip
+// counts and are left to the compiler, since unrolling both levels at 4096
+// bits makes compile times explode. Everything except conversion to and from
+// precn_t is constexpr.
+//
+// precn::Montgomery<Bits> does modular multiplication and exponentiation
+// for an odd modulus using word-by-word (CIOS) Montgomery reduction.
+#ifndef PREC_FIXED_HPP
+#define PREC_FIXED_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "prec.hpp"
+
+namespace precn {
+
+namespace detail {
+
+template <class F, std::size_t... I>
+constexpr void unroll_impl(F &&f, std::index_sequence<I...>) {
+    (f(std::integral_constant<std::size_t, I>()), ...);
+}
+
+// Call f(0), f(1), ..., f(N - 1) with the index as a compile-time constant
+template <std::size_t N, class F>
+constexpr void unroll(F &&f) {
+    unroll_impl(f, std::make_index_sequence<N>());
+}
+
+} // namespace detail
+
+template <int Bits>
+class Fixed {
+    static_assert(Bits % 32 == 0 && Bits >= 64, "Fixed width must be a multiple of 32 bits");
+
+public:
+    static constexpr int limbs = Bits / 32;
+
+    uint32_t a[limbs] = {}; // little endian
+
+    constexpr Fixed() = default;
+
+    constexpr Fixed(uint32_t val) {
+        a[0] = val;
+    }
+
+    // Truncating conversion from precn_t: limbs above Bits are dropped
+    static Fixed from(precn_srcptr n) {
+        Fixed r;
+        for (int i = 0; i < limbs && i < n->siz; i++) {
+            r.a[i] = n->a[i];
+        }
+        return r;
+    }
+
+    static Fixed from(const Int &n) {
+        return from(n.get());
+    }
+
+    void to(precn_t n) const {
+        if (n->alloc_size < limbs) {
+            n->a = (uint32_t*)realloc(n->a, limbs * sizeof(uint32_t));
+            n->alloc_size = limbs;
+        }
+        memcpy(n->a, a, sizeof(a));
+        n->siz = limbs;
+        precn_normalize(n);
+    }
+
+    Int to_int() const {
+        Int r = Int::adopt(precn_new(limbs));
+        to(r.get());
+        return r;
+    }
+
+    constexpr bool is_zero() const {
+        uint32_t acc = 0;
+        detail::unroll<limbs>([&](auto i) { acc |= a[i]; });
+        return acc == 0;
+    }
+
+    // res = x + y mod 2^Bits, returns the carry out
+    static constexpr uint32_t add(Fixed &res, const Fixed &x, const Fixed &y) {
+        uint64_t carry = 0;
+        detail::unroll<limbs>([&](auto i) {
+            uint64_t sum = (uint64_t)x.a[i] + y.a[i] + carry;
+            res.a[i] = (uint32_t)sum;
+            carry = sum >> 32;
+        });
+        return (uint32_t)carry;
+    }
+
+    // res = x - y mod 2^Bits, returns the borrow out
+    static constexpr uint32_t sub(Fixed &res, const Fixed &x, const Fixed &y) {
+        uint64_t borrow = 0;
+        detail::unroll<limbs>([&](auto i) {
+            uint64_t diff = (uint64_t)x.a[i] - y.a[i] - borrow;
+            res.a[i] = (uint32_t)diff;
+            borrow = (diff >> 32) & 1;
+        });
+        return (uint32_t)borrow;
+    }
+
+    // Full product: lo + hi * 2^Bits = x * y
+    static constexpr void mul(Fixed &lo, Fixed &hi, const Fixed &x, const Fixed &y) {
+        uint32_t t[2 * limbs] = {};
+        for (int i = 0; i < limbs; i++) {
+            uint64_t carry = 0;
+            detail::unroll<limbs>([&](auto j) {
+                uint64_t prod = (uint64_t)x.a[i] * y.a[j] + t[i + j] + carry;
+                t[i + j] = (uint32_t)prod;
+                carry = prod >> 32;
+            });
+            t[i + limbs] = (uint32_t)carry;
+        }
+        detail::unroll<limbs>([&](auto i) {
+            lo.a[i] = t[i];
+            hi.a[i] = t[i + limbs];
+        });
+    }
+
+    // Compare x and y: returns -1 if x < y, 0 if x == y, 1 if x > y
+    static constexpr int cmp(const Fixed &x, const Fixed &y) {
+        for (int i = limbs - 1; i >= 0; --i) {
+            if (x.a[i] < y.a[i]) return -1;
+            if (x.a[i] > y.a[i]) return 1;
+        }
+        return 0;
+    }
+
+    friend constexpr Fixed operator+(const Fixed &x, const Fixed &y) {
+        Fixed r;
+        add(r, x, y);
+        return r;
+    }
+
+    friend constexpr Fixed operator-(const Fixed &x, const Fixed &y) {
+        Fixed r;
+        sub(r, x, y);
+        return r;
+    }
+
+    // Low Bits of the product
+    friend constexpr Fixed operator*(const Fixed &x, const Fixed &y) {
+        Fixed r;
+        for (int i = 0; i < limbs; i++) {
+            uint64_t carry = 0;
+            for (int j = 0; j < limbs - i; j++) {
+                uint64_t prod = (uint64_t)x.a[i] * y.a[j] + r.a[i + j] + carry;
+                r.a[i + j] = (uint32_t)prod;
+                carry = prod >> 32;
+            }
+        }
+        return r;
+    }
+
+    friend constexpr bool operator==(const Fixed &x, const Fixed &y) { return cmp(x, y) == 0; }
+    friend constexpr bool operator!=(const Fixed &x, const Fixed &y) { return cmp(x, y) != 0; }
+    friend constexpr bool operator<(const Fixed &x, const Fixed &y) { return cmp(x, y) < 0; }
+    friend constexpr bool operator>(const Fixed &x, const Fixed &y) { return cmp(x, y) > 0; }
+    friend constexpr bool operator<=(const Fixed &x, const Fixed &y) { return cmp(x, y) <= 0; }
+    friend constexpr bool operator>=(const Fixed &x, const Fixed &y) { return cmp(x, y) >= 0; }
+};
+
+// Montgomery arithmetic modulo an odd m < 2^Bits, with R = 2^Bits
+template <int Bits>
+class Montgomery {
+public:
+    using value_type = Fixed<Bits>;
+    static constexpr int limbs = value_type::limbs;
+
+    constexpr explicit Montgomery(const value_type &m) : m_(m), minv_(neg_inverse(m.a[0])), r2_() {
+        // R^2 mod m by 2 * Bits modular doublings of 1
+        value_type x(1);
+        for (int i = 0; i < 2 * Bits; i++) {
+            uint32_t carry = value_type::add(x, x, x);
+            if (carry || x >= m_) {
+                value_type::sub(x, x, m_);
+            }
+        }
+        r2_ = x;
+    }
+
+    constexpr const value_type &modulus() const { return m_; }
+
+    // x * R mod m, for x < m
+    constexpr value_type to_mont(const value_type &x) const {
+        return mul(x, r2_);
+    }
+
+    // x / R mod m
+    constexpr value_type from_mont(const value_type &x) const {
+        return mul(x, value_type(1));
+    }
+
+    // x * y / R mod m, for Montgomery-form x, y < m
+    constexpr value_type mul(const value_type &x, const value_type &y) const {
+        uint32_t t[limbs + 2] = {};
+        for (int i = 0; i < limbs; i++) {
+            // t += x * y[i]
+            uint64_t carry = 0;
+            detail::unroll<limbs>([&](auto j) {
+                uint64_t prod = (uint64_t)x.a[j] * y.a[i] + t[j] + carry;
+                t[j] = (uint32_t)prod;
+                carry = prod >> 32;
+            });
+            uint64_t top = (uint64_t)t[limbs] + carry;
+            t[limbs] = (uint32_t)top;
+            t[limbs + 1] = (uint32_t)(top >> 32);
+
+            // t = (t + q * m) / 2^32 with q chosen so the low limb cancels
+            uint32_t q = t[0] * minv_;
+            carry = ((uint64_t)q * m_.a[0] + t[0]) >> 32;
+            detail::unroll<limbs - 1>([&](auto j) {
+                uint64_t prod = (uint64_t)q * m_.a[j + 1] + t[j + 1] + carry;
+                t[j] = (uint32_t)prod;
+                carry = prod >> 32;
+            });
+            top = (uint64_t)t[limbs] + carry;
+            t[limbs - 1] = (uint32_t)top;
+            t[limbs] = t[limbs + 1] + (uint32_t)(top >> 32);
+        }
+
+        value_type r;
+        detail::unroll<limbs>([&](auto i) { r.a[i] = t[i]; });
+        if (t[limbs] || r >= m_) {
+            value_type::sub(r, r, m_);
+        }
+        return r;
+    }
+
+    // (x + y) mod m, for x, y < m
+    constexpr value_type add(const value_type &x, const value_type &y) const {
+        value_type r;
+        uint32_t carry = value_type::add(r, x, y);
+        if (carry || r >= m_) {
+            value_type::sub(r, r, m_);
+        }
+        return r;
+    }
+
+    // (x - y) mod m, for x, y < m
+    constexpr value_type sub(const value_type &x, const value_type &y) const {
+        value_type r;
+        if (value_type::sub(r, x, y)) {
+            value_type::add(r, r, m_);
+        }
+        return r;
+    }
+
+    // base^exp mod m, with base and result in normal (not Montgomery) form
+    template <int ExpBits>
+    constexpr value_type pow(const value_type &base, const Fixed<ExpBits> &exp) const {
+        value_type b = to_mont(base);
+        value_type r = to_mont(value_type(1));
+        for (int i = ExpBits - 1; i >= 0; --i) {
+            r = mul(r, r);
+            if ((exp.a[i / 32] >> (i % 32)) & 1) {
+                r = mul(r, b);
+            }
+        }
+        return from_mont(r);
+    }
+
+private:
+    value_type m_;
+    uint32_t minv_; // -m^-1 mod 2^32
+    value_type r2_; // R^2 mod m
+
+    // Newton iteration doubles the correct low bits of the inverse each step
+    static constexpr uint32_t neg_inverse(uint32_t m0) {
+        uint32_t inv = m0; // correct to 3 bits for odd m0
+        for (int i = 0; i < 4; i++) {
+            inv *= 2 - m0 * inv;
+        }
+        return 0u - inv;
+    }
+};
+
+} // namespace precn
+
+#endif // PREC_FIXED_HPP
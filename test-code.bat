@@ -1,2 +1,4 @@
 clang -o test.exe test.c
-.\test.exe
\ No newline at end of file
+.\test.exe
+clang++ -std=c++17 -o test-cpp.exe test-cpp.cpp
+.\test-cpp.exe
\ No newline at end of file
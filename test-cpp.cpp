@@ -0,0 +1,197 @@
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+#include "prec.hpp"
+#include "prec_fixed.hpp"
+
+using precn::Int;
+using precn::Fixed;
+using precn::Montgomery;
+
+static Int random_int(int words) {
+    Int r = Int::adopt(precn_new(words));
+    for (int i = 0; i < words; i++) {
+        r.get()->a[i] = ((uint32_t)rand() << 16) | rand();
+    }
+    r.get()->siz = words;
+    precn_normalize(r.get());
+    return r;
+}
+
+void test_ownership() {
+    printf("Testing Int ownership and moves...\n");
+    
+    Int a = random_int(100);
+    uint32_t *limbs = a.get()->a;
+    
+    // Move construction and assignment steal the buffer
+    Int b(std::move(a));
+    assert(b.get()->a == limbs);
+    Int c;
+    c = std::move(b);
+    assert(c.get()->a == limbs);
+    
+    // Moved-from values can be assigned again
+    a = Int(7);
+    assert(a == Int(7));
+    
+    // Copies are deep
+    Int d = c;
+    assert(d == c && d.get()->a != c.get()->a);
+    
+    // A const Int only exposes a read-only value
+    static_assert(std::is_same<decltype(std::declval<const Int &>().get()), precn_srcptr>::value,
+                  "const get() must not hand out a mutable precn_t");
+    
+    printf("Ownership tests passed!\n\n");
+}
+
+void test_operators() {
+    printf("Testing Int operators...\n");
+    
+    Int a(42), b(17);
+    assert(a + b == Int(59));
+    assert(a - b == Int(25));
+    assert(b - a == Int(25));
+    assert(Int(a * b) == Int(714));
+    assert(a / b == Int(2));
+    assert(a % b == Int(8));
+    assert((Int(1) << 40) > Int(0xFFFFFFFF));
+    assert(a > b && b < a && a != b);
+    
+    bool threw = false;
+    try {
+        a /= Int(0);
+    } catch (const std::domain_error &) {
+        threw = true;
+    }
+    assert(threw);
+    
+    printf("Operator tests passed!\n\n");
+}
+
+void test_fused_expressions() {
+    printf("Testing fused expressions...\n");
+    
+    srand(4242);
+    Int a = random_int(300), b = random_int(170), c = random_int(500), m = random_int(90);
+    
+    Int prod = a * b;
+    Int expected = prod + c;
+    
+    // a * b + c in either order, fresh and into an existing Int
+    Int x = a * b + c;
+    assert(x == expected);
+    x = c + a * b;
+    assert(x == expected);
+    
+    // Accumulate
+    Int acc = c;
+    acc += a * b;
+    assert(acc == expected);
+    
+    // (a * b) % m
+    Int r = (a * b) % m;
+    assert(r == prod % m);
+    
+    // Aliasing the target with an operand
+    Int y = a;
+    y = y * b + c;
+    assert(y == expected);
+    y = a;
+    y *= b;
+    assert(y == prod);
+    y = m;
+    y = (a * b) % y;
+    assert(y == r);
+    y = c;
+    y = a * b + y;
+    assert(y == expected);
+    
+    printf("Fused expression tests passed!\n\n");
+}
+
+// Evaluated entirely at compile time
+static_assert(Montgomery<128>(Fixed<128>(101)).pow(Fixed<128>(3), Fixed<64>(4)) == Fixed<128>(81),
+              "constexpr Montgomery exponentiation");
+
+template <int Bits>
+void check_fixed_width(int rounds) {
+    using F = Fixed<Bits>;
+    const int words = F::limbs;
+    Int two_pow = Int(1) << Bits;
+    
+    for (int r = 0; r < rounds; r++) {
+        Int x = random_int(words), y = random_int(words), m = random_int(words);
+        if (m.get()->siz == 0) m = Int(1);
+        m.get()->a[0] |= 1; // Montgomery needs an odd modulus
+        if (x >= m) x = x % m;
+        if (y >= m) y = y % m;
+        F fx = F::from(x), fy = F::from(y), fm = F::from(m);
+        
+        // Round trip through precn_t
+        assert(fx.to_int() == x);
+        
+        // Add with carry out
+        F sum;
+        uint32_t carry = F::add(sum, fx, fy);
+        Int expected_sum = x + y;
+        assert((carry ? sum.to_int() + two_pow : sum.to_int()) == expected_sum);
+        
+        // Subtract with borrow out
+        F diff;
+        uint32_t borrow = F::sub(diff, fx, fy);
+        assert(borrow == (x < y ? 1u : 0u));
+        assert(borrow ? (diff.to_int() + (x < y ? y - x : x - y)) == two_pow
+                      : diff.to_int() == x - y);
+        
+        // Full and truncated products
+        F lo, hi;
+        F::mul(lo, hi, fx, fy);
+        Int prod = x * y;
+        assert((hi.to_int() << Bits) + lo.to_int() == prod);
+        assert(fx * fy == lo);
+        
+        // Montgomery multiplication and modular arithmetic
+        Montgomery<Bits> mont(fm);
+        F mx = mont.to_mont(fx), my = mont.to_mont(fy);
+        assert(mont.from_mont(mx) == fx);
+        Int expected_mod = (x * y) % m;
+        assert(mont.from_mont(mont.mul(mx, my)).to_int() == expected_mod);
+        assert(mont.add(fx, fy).to_int() == expected_sum % m);
+        assert(mont.sub(mont.add(fx, fy), fy) == fx);
+        
+        // Exponentiation against repeated multiplication
+        Int expected_pow(1);
+        for (int e = 0; e < 13; e++) {
+            expected_pow = (expected_pow * x) % m;
+        }
+        assert(mont.pow(fx, Fixed<64>(13)).to_int() == expected_pow);
+    }
+}
+
+void test_fixed_width() {
+    printf("Testing fixed-width integers...\n");
+    
+    srand(9001);
+    check_fixed_width<256>(50);
+    check_fixed_width<1024>(20);
+    check_fixed_width<4096>(3);
+    
+    printf("Fixed-width tests passed!\n\n");
+}
+
+int main() {
+    printf("Testing precn C++ wrapper\n");
+    printf("=========================\n\n");
+    
+    test_ownership();
+    test_operators();
+    test_fused_expressions();
+    test_fixed_width();
+    
+    printf("All tests passed successfully!\n");
+    return 0;
+}
@@ -2,11 +2,28 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <assert.h>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
 
 // Include the prec.c file directly for simplicity
 // In a real project, you would separate declaration and implementation
 #include "prec.c"
 
+// To check that shared read-only values are race free, build with
+//   cc -O1 -g -fsanitize=thread -o test test.c -lpthread
+
+// A new value with words random limbs
+static precn_t random_precn(int words) {
+    precn_t r = precn_new(words);
+    for (int i = 0; i < words; i++) {
+        r->a[i] = ((uint32_t)rand() << 16) | rand();
+    }
+    r->siz = words;
+    precn_normalize(r);
+    return r;
+}
+
 void test_basic_operations() {
     printf("Testing basic operations...\n");
     
@@ -385,6 +402,54 @@ void test_modular_operations() {
     printf("Modular operations tests passed!\n\n");
 }
 
+void test_mulmod() {
+    printf("Testing modular multiplication...\n");
+    
+    srand(6060);
+    
+    int sizes[][3] = { {40, 30, 1}, {40, 30, 2}, {40, 30, 3}, {120, 90, 50}, {20, 20, 45}, {64, 64, 64} };
+    for (int t = 0; t < 6; t++) {
+        precn_t a = precn_new(sizes[t][0]);
+        precn_t b = precn_new(sizes[t][1]);
+        precn_t m = precn_new(sizes[t][2]);
+        precn_t result = precn_new(1);
+        precn_t prod = precn_new(1);
+        precn_t expected = precn_new(1);
+        
+        // Case 5 uses all-ones words to hit the q = B - 1 estimate and add-back
+        for (int i = 0; i < sizes[t][0]; i++) a->a[i] = t == 5 ? 0xFFFFFFFF : ((uint32_t)rand() << 16) | rand();
+        for (int i = 0; i < sizes[t][1]; i++) b->a[i] = t == 5 ? 0xFFFFFFFF : ((uint32_t)rand() << 16) | rand();
+        for (int i = 0; i < sizes[t][2]; i++) m->a[i] = t == 5 ? 0xFFFFFFFF : ((uint32_t)rand() << 16) | rand();
+        if (t == 5) m->a[0] = 0xFFFFFFFE;
+        a->siz = sizes[t][0];
+        b->siz = sizes[t][1];
+        m->siz = sizes[t][2];
+        precn_normalize(a);
+        precn_normalize(b);
+        precn_normalize(m);
+        
+        precn_mul(prod, a, b);
+        precn_mod(expected, prod, m);
+        assert(precn_mulmod(result, a, b, m) == 0);
+        assert(precn_cmp(result, expected) == 0);
+        
+        precn_free(a);
+        precn_free(b);
+        precn_free(m);
+        precn_free(result);
+        precn_free(prod);
+        precn_free(expected);
+    }
+    
+    precn_t x = precn_new(1), zero = precn_new(1);
+    precn_set_u32(x, 7);
+    assert(precn_mulmod(x, x, x, zero) == -1);
+    precn_free(x);
+    precn_free(zero);
+    
+    printf("Modular multiplication tests passed!\n\n");
+}
+
 void test_random_modular() {
     printf("Testing random modular operations...\n");
     
@@ -533,6 +598,594 @@ void test_random_division() {
     printf("All random division tests passed!\n\n");
 }
 
+void test_serialization() {
+    printf("Testing binary serialization and mapped views...\n");
+    
+    srand(777);
+    
+    precn_t a = precn_new(1000);
+    precn_t b = precn_new(1);
+    precn_t zero = precn_new(1);
+    for (int i = 0; i < 1000; i++) {
+        a->a[i] = ((uint32_t)rand() << 16) | rand();
+    }
+    a->siz = 1000;
+    precn_normalize(a);
+    
+    FILE *f = tmpfile();
+    assert(f != NULL);
+    int fd = fileno(f);
+    
+    // Round trip through write/read, including an empty value
+    assert(precn_write(fd, a) == 0);
+    assert(precn_write(fd, zero) == 0);
+    lseek(fd, 0, SEEK_SET);
+    assert(precn_read(b, fd) == 0);
+    assert(precn_cmp(a, b) == 0);
+    precn_set_u32(b, 5);
+    assert(precn_read(b, fd) == 0);
+    assert(b->siz == 0);
+    
+    // Truncated stream must fail
+    assert(precn_read(b, fd) == -1);
+    
+    // Mapped view sees the same limbs without copying
+    precn_srcptr view = precn_map(fd);
+    assert(view != NULL);
+    assert(precn_cmp(view, a) == 0);
+    precn_mul(b, view, view);
+    precn_mul(zero, a, a);
+    assert(precn_cmp(b, zero) == 0);
+    precn_unmap(view);
+    fclose(f);
+    
+    // Bad magic is rejected by both paths
+    f = tmpfile();
+    fd = fileno(f);
+    assert(precn_io_full(fd, "NOPE0000000000000", PRECN_HEADER_SIZE, 1) == 0);
+    lseek(fd, 0, SEEK_SET);
+    assert(precn_read(b, fd) == -1);
+    assert(precn_map(fd) == NULL);
+    fclose(f);
+    
+    precn_free(a);
+    precn_free(b);
+    precn_free(zero);
+    
+    printf("Serialization tests passed!\n\n");
+}
+
+void test_out_of_core_multiplication() {
+    printf("Testing out-of-core multiplication...\n");
+    
+    srand(2468);
+    
+    int sizes[][2] = { {3000, 1100}, {257, 4000}, {64, 64}, {1, 700}, {0, 50} };
+    for (int t = 0; t < 5; t++) {
+        int n = sizes[t][0], m = sizes[t][1];
+        precn_t a = precn_new(n);
+        precn_t b = precn_new(m);
+        precn_t expected = precn_new(n + m);
+        for (int i = 0; i < n; i++) a->a[i] = ((uint32_t)rand() << 16) | rand();
+        for (int i = 0; i < m; i++) b->a[i] = ((uint32_t)rand() << 16) | rand();
+        a->siz = n;
+        b->siz = m;
+        precn_normalize(a);
+        precn_normalize(b);
+        precn_mul(expected, a, b);
+        
+        FILE *fa = tmpfile(), *fb = tmpfile(), *fr = tmpfile();
+        assert(precn_write(fileno(fa), a) == 0);
+        assert(precn_write(fileno(fb), b) == 0);
+        precn_srcptr va = precn_map(fileno(fa));
+        precn_srcptr vb = precn_map(fileno(fb));
+        assert(va != NULL && vb != NULL);
+        
+        // Small budget forces many blocks per operand; the 64 x 64 case gets a
+        // huge one, which must be clamped to the operand size
+        size_t budget = t == 2 ? (size_t)1 << 31 : 4096;
+        assert(precn_mul_file(fileno(fr), va, vb, budget) == 0);
+        precn_srcptr vr = precn_map(fileno(fr));
+        assert(vr != NULL);
+        assert(precn_cmp(vr, expected) == 0);
+        printf("%d x %d words: ok\n", n, m);
+        
+        precn_unmap(va);
+        precn_unmap(vb);
+        precn_unmap(vr);
+        fclose(fa);
+        fclose(fb);
+        fclose(fr);
+        precn_free(a);
+        precn_free(b);
+        precn_free(expected);
+    }
+    
+    printf("Out-of-core multiplication tests passed!\n\n");
+}
+
+void test_rns() {
+    printf("Testing residue number system arithmetic...\n");
+    
+    srand(13579);
+    
+    // (a * b + c) * a - d, evaluated in RNS and directly
+    precn_t a = random_precn(60);
+    precn_t b = random_precn(45);
+    precn_t c = random_precn(100);
+    precn_t d = random_precn(20);
+    
+    precn_t expected = precn_new(300);
+    precn_t temp = precn_new(300);
+    precn_mul(temp, a, b);
+    precn_add(temp, temp, c);
+    precn_mul(expected, temp, a);
+    precn_sub(expected, expected, d);
+    
+    precn_rns_ctx_t ctx = precn_rns_ctx_new(300 * 32);
+    precn_rns_t ra = precn_rns_new(ctx), rb = precn_rns_new(ctx);
+    precn_rns_t rc = precn_rns_new(ctx), rd = precn_rns_new(ctx);
+    precn_rns_t acc = precn_rns_new(ctx);
+    precn_rns_set(ra, a);
+    precn_rns_set(rb, b);
+    precn_rns_set(rc, c);
+    precn_rns_set(rd, d);
+    
+    // Round trip
+    precn_rns_get(temp, rc);
+    assert(precn_cmp(temp, c) == 0);
+    
+    precn_rns_mul(acc, ra, rb);
+    precn_rns_add(acc, acc, rc);
+    precn_rns_mul(acc, acc, ra);
+    precn_rns_sub(acc, acc, rd);
+    precn_rns_get(temp, acc);
+    assert(precn_cmp(temp, expected) == 0);
+    
+    // A negative intermediate wraps and comes back: (d - a) + a = d
+    precn_rns_sub(acc, rd, ra);
+    precn_rns_add(acc, acc, ra);
+    precn_rns_get(temp, acc);
+    assert(precn_cmp(temp, d) == 0);
+    
+    // Zero
+    precn_zero(temp);
+    precn_rns_set(acc, temp);
+    precn_rns_get(temp, acc);
+    assert(temp->siz == 0);
+    
+    precn_rns_free(ra);
+    precn_rns_free(rb);
+    precn_rns_free(rc);
+    precn_rns_free(rd);
+    precn_rns_free(acc);
+    precn_rns_ctx_free(ctx);
+    precn_free(a);
+    precn_free(b);
+    precn_free(c);
+    precn_free(d);
+    precn_free(expected);
+    precn_free(temp);
+    
+    printf("RNS tests passed!\n\n");
+}
+
+void test_single_limb_division() {
+    printf("Testing single- and two-word division...\n");
+    
+    srand(8642);
+    
+    uint64_t divisors[] = { 1, 3, 10, 1000, 0x80000000u, 0xFFFFFFFFu, 0x100000000ull,
+                            0x123456789ull, 0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull };
+    precn_t a = precn_new(200);
+    precn_t q = precn_new(200);
+    precn_t d = precn_new(2);
+    precn_t r = precn_new(2);
+    precn_t check = precn_new(205);
+    
+    for (int t = 0; t < 10; t++) {
+        for (int size = 0; size <= 200; size += 40) {
+            for (int i = 0; i < size; i++) a->a[i] = ((uint32_t)rand() << 16) | rand();
+            a->siz = size;
+            precn_normalize(a);
+            
+            uint64_t rem = 0;
+            assert(precn_divmod_u64(q, &rem, a, divisors[t]) == 0);
+            assert(rem < divisors[t]);
+            
+            // q * d + r == a
+            precn_zero(d);
+            d->a[0] = (uint32_t)divisors[t];
+            d->a[1] = (uint32_t)(divisors[t] >> 32);
+            d->siz = 2;
+            precn_normalize(d);
+            precn_zero(r);
+            r->a[0] = (uint32_t)rem;
+            r->a[1] = (uint32_t)(rem >> 32);
+            r->siz = 2;
+            precn_normalize(r);
+            precn_mul(check, q, d);
+            precn_add(check, check, r);
+            assert(precn_cmp(check, a) == 0);
+            
+            // precn_divmod dispatches to the same path
+            precn_t q2 = precn_new(1), r2 = precn_new(1);
+            assert(precn_divmod(q2, r2, a, d) == 0);
+            assert(precn_cmp(q2, q) == 0 && precn_cmp(r2, r) == 0);
+            precn_free(q2);
+            precn_free(r2);
+            
+            // In place, remainder only
+            if (divisors[t] >> 32 == 0) {
+                uint32_t rem32;
+                precn_copy(check, a);
+                assert(precn_divmod_u32(check, &rem32, check, (uint32_t)divisors[t]) == 0);
+                assert(rem32 == rem && precn_cmp(check, q) == 0);
+                assert(precn_divmod_u32(NULL, &rem32, a, (uint32_t)divisors[t]) == 0);
+                assert(rem32 == rem);
+            }
+        }
+    }
+    assert(precn_divmod_u32(q, NULL, a, 0) == -1);
+    assert(precn_divmod_u64(q, NULL, a, 0) == -1);
+    
+    precn_free(a);
+    precn_free(q);
+    precn_free(d);
+    precn_free(r);
+    precn_free(check);
+    
+    printf("Single- and two-word division tests passed!\n\n");
+}
+
+void test_exact_division() {
+    printf("Testing exact division and divisibility...\n");
+    
+    srand(97531);
+    
+    int sizes[][2] = { {1, 1}, {50, 3}, {300, 120}, {7, 40}, {200, 2} };
+    for (int t = 0; t < 5; t++) {
+        int qs = sizes[t][0], ds = sizes[t][1];
+        precn_t q = precn_new(qs);
+        precn_t d = precn_new(ds);
+        precn_t a = precn_new(qs + ds + 1);
+        precn_t result = precn_new(1);
+        precn_t one = precn_new(1);
+        for (int i = 0; i < qs; i++) q->a[i] = ((uint32_t)rand() << 16) | rand();
+        for (int i = 0; i < ds; i++) d->a[i] = ((uint32_t)rand() << 16) | rand();
+        q->siz = qs;
+        d->siz = ds;
+        // Even divisors exercise the power-of-two stripping
+        d->a[0] &= ~(uint32_t)(t & 1 ? 0xFF : 0);
+        d->a[0] = d->a[0] ? d->a[0] : 0x100;
+        precn_normalize(q);
+        precn_normalize(d);
+        precn_mul(a, q, d);
+        
+        assert(precn_divexact(result, a, d) == 0);
+        assert(precn_cmp(result, q) == 0);
+        assert(precn_divisible(a, d) == 1);
+        
+        // a + 1 is not a multiple of d (d > 1 here)
+        precn_set_u32(one, 1);
+        precn_add(a, a, one);
+        assert(precn_divisible(a, d) == 0);
+        
+        precn_free(q);
+        precn_free(d);
+        precn_free(a);
+        precn_free(result);
+        precn_free(one);
+    }
+    
+    precn_t zero = precn_new(1);
+    precn_t x = precn_new(1);
+    precn_set_u32(x, 12);
+    assert(precn_divisible(x, zero) == -1);
+    assert(precn_divexact(x, x, zero) == -1);
+    assert(precn_divisible(zero, x) == 1);
+    precn_free(zero);
+    precn_free(x);
+    
+    printf("Exact division tests passed!\n\n");
+}
+
+void test_scalar_operations() {
+    printf("Testing scalar-operand operations...\n");
+    
+    srand(112233);
+    
+    uint64_t values[] = { 0, 1, 0xFFFFFFFFu, 0x100000000ull, 0xFFFFFFFFFFFFFFFFull, 0x123456789ABCDEFull };
+    int sizes[] = { 0, 1, 2, 3, 50 };
+    precn_t a = precn_new(50);
+    precn_t v = precn_new(2);
+    precn_t expected = precn_new(60);
+    precn_t result = precn_new(1);
+    
+    for (int s = 0; s < 5; s++) {
+        for (int t = 0; t < 6; t++) {
+            // All-ones limbs make carries run the full length
+            for (int i = 0; i < sizes[s]; i++) {
+                a->a[i] = (t & 1) ? 0xFFFFFFFF : ((uint32_t)rand() << 16) | rand();
+            }
+            a->siz = sizes[s];
+            precn_normalize(a);
+            precn_set_u64(v, values[t]);
+            assert(precn_cmp_u64(v, values[t]) == 0);
+            assert(precn_cmp_u64(a, values[t]) == precn_cmp(a, v));
+            
+            precn_add(expected, a, v);
+            precn_add_u64(result, a, values[t]);
+            assert(precn_cmp(result, expected) == 0);
+            precn_copy(result, a);
+            precn_add_u64(result, result, values[t]);
+            assert(precn_cmp(result, expected) == 0);
+            
+            precn_sub(expected, a, v);
+            precn_sub_u64(result, a, values[t]);
+            assert(precn_cmp(result, expected) == 0);
+            precn_copy(result, a);
+            precn_sub_u64(result, result, values[t]);
+            assert(precn_cmp(result, expected) == 0);
+            
+            precn_mul(expected, a, v);
+            precn_mul_u64(result, a, values[t]);
+            assert(precn_cmp(result, expected) == 0);
+            precn_copy(result, a);
+            precn_mul_u64(result, result, values[t]);
+            assert(precn_cmp(result, expected) == 0);
+            
+            // res += a * val, starting from a nonzero accumulator
+            precn_copy(result, a);
+            precn_copy(expected, a);
+            precn_addmul(expected, a, v);
+            precn_addmul_u64(result, a, values[t]);
+            assert(precn_cmp(result, expected) == 0);
+        }
+    }
+    
+    // Accumulating loop: sum of i * 2^40 for i < 1000 without temporaries
+    precn_zero(result);
+    for (uint64_t i = 0; i < 1000; i++) {
+        precn_add_u64(result, result, i << 40);
+    }
+    precn_set_u64(v, 499500);
+    precn_shl(expected, v, 40);
+    assert(precn_cmp(result, expected) == 0);
+    
+    precn_free(a);
+    precn_free(v);
+    precn_free(expected);
+    precn_free(result);
+    
+    printf("Scalar operation tests passed!\n\n");
+}
+
+void test_powers_and_factorials() {
+    printf("Testing squaring, powers, factorials and binomials...\n");
+    
+    srand(55555);
+    
+    precn_t a = precn_new(257);
+    precn_t result = precn_new(1);
+    precn_t expected = precn_new(1);
+    precn_t temp = precn_new(1);
+    
+    // Squaring against general multiplication, on both sides of the Karatsuba threshold
+    int sizes[] = { 0, 1, 2, 7, 40, 65, 150, 257 };
+    for (int t = 0; t < 8; t++) {
+        for (int i = 0; i < sizes[t]; i++) {
+            a->a[i] = (t & 1) ? 0xFFFFFFFF : ((uint32_t)rand() << 16) | rand();
+        }
+        a->siz = sizes[t];
+        precn_normalize(a);
+        precn_sqr(result, a);
+        precn_mul(expected, a, a);
+        assert(precn_cmp(result, expected) == 0);
+    }
+    
+    // Powers against repeated multiplication, for the 1- and 3-bit windows
+    for (int i = 0; i < 3; i++) a->a[i] = ((uint32_t)rand() << 16) | rand();
+    a->siz = 3;
+    unsigned long exponents[] = { 0, 1, 2, 5, 37, 100, 255 };
+    for (int t = 0; t < 7; t++) {
+        precn_set_u32(expected, 1);
+        for (unsigned long e = 0; e < exponents[t]; e++) {
+            precn_mul(temp, expected, a);
+            precn_copy(expected, temp);
+        }
+        precn_pow_ui(result, a, exponents[t]);
+        assert(precn_cmp(result, expected) == 0);
+    }
+    precn_copy(result, a);
+    precn_pow_ui(result, result, 37);
+    precn_pow_ui(expected, a, 37);
+    assert(precn_cmp(result, expected) == 0);
+    
+    // Wider windows need exponents above 2^24 (w = 4) and 2^48 (w = 5), too
+    // big for repeated multiplication: check 2^e against a shift, and 1^e
+    unsigned long big = (1UL << 24) + 0x5A5A5;
+    precn_set_u32(temp, 1);
+    precn_shl(expected, temp, (int)big);
+    precn_set_u32(temp, 2);
+    precn_pow_ui(result, temp, big);
+    assert(precn_cmp(result, expected) == 0);
+    precn_set_u32(temp, 1);
+    precn_pow_ui(result, temp, ~0UL); // 64 bits where unsigned long allows, so w = 5
+    assert(precn_cmp_u64(result, 1) == 0);
+    
+    // Factorials against a running product
+    precn_set_u32(expected, 1);
+    for (unsigned long n = 0; n <= 3000; n++) {
+        if (n > 0) {
+            precn_mul_u64(expected, expected, n);
+        }
+        if (n % 250 == 0 || n < 20) {
+            precn_fac_ui(result, n);
+            assert(precn_cmp(result, expected) == 0);
+        }
+    }
+    
+    // Binomials against the multiplicative formula C(n, i+1) = C(n, i) * (n-i) / (i+1)
+    unsigned long n = 2000;
+    precn_set_u32(expected, 1);
+    for (unsigned long k = 0; k <= n; k++) {
+        if (k % 97 == 0 || k == n) {
+            precn_bin_ui(result, n, k);
+            assert(precn_cmp(result, expected) == 0);
+        }
+        precn_mul_u64(expected, expected, n - k);
+        precn_divmod_u32(expected, NULL, expected, (uint32_t)(k + 1));
+    }
+    precn_bin_ui(result, 10, 11);
+    assert(result->siz == 0);
+    
+    // Large n with small k must not cost O(n)
+    n = 100000000;
+    precn_set_u32(expected, 1);
+    for (unsigned long k = 0; k <= 5; k++) {
+        precn_bin_ui(result, n, k);
+        assert(precn_cmp(result, expected) == 0);
+        precn_mul_u64(expected, expected, n - k);
+        precn_divmod_u32(expected, NULL, expected, (uint32_t)(k + 1));
+    }
+    
+    // Small binomials against Pascal's triangle
+    uint64_t row[42] = { 1 };
+    for (unsigned long m = 0; m <= 40; m++) {
+        for (unsigned long k = 0; k <= m; k++) {
+            precn_bin_ui(result, m, k);
+            assert(precn_cmp_u64(result, row[k]) == 0);
+        }
+        for (unsigned long k = m + 1; k > 0; k--) {
+            row[k] += row[k - 1];
+        }
+    }
+    
+    precn_free(a);
+    precn_free(result);
+    precn_free(expected);
+    precn_free(temp);
+    
+    printf("Power, factorial and binomial tests passed!\n\n");
+}
+
+void test_unbalanced_multiplication() {
+    printf("Testing balanced and unbalanced multiplication...\n");
+    
+    srand(31415);
+    
+    int sizes[][2] = { {5000, 40}, {3000, 700}, {1000, 999}, {64, 64}, {100, 31},
+                       {33, 1}, {4097, 2048}, {2047, 1024}, {31, 5000}, {250, 33} };
+    for (int t = 0; t < 10; t++) {
+        int n = sizes[t][0], m = sizes[t][1];
+        precn_t a = precn_new(n);
+        precn_t b = precn_new(m);
+        precn_t result = precn_new(1);
+        uint32_t *expected = (uint32_t*)malloc((n + m) * sizeof(uint32_t));
+        
+        // Odd cases use all-ones limbs so carries run through every level
+        for (int i = 0; i < n; i++) a->a[i] = (t & 1) ? 0xFFFFFFFF : ((uint32_t)rand() << 16) | rand();
+        for (int i = 0; i < m; i++) b->a[i] = (t & 1) ? 0xFFFFFFFF : ((uint32_t)rand() << 16) | rand();
+        a->siz = n;
+        b->siz = m;
+        precn_normalize(a);
+        precn_normalize(b);
+        
+        precn_mul_basecase(expected, a->a, n, b->a, m);
+        precn_mul(result, a, b);
+        int esz = n + m;
+        while (esz > 0 && expected[esz - 1] == 0) esz--;
+        assert(result->siz == esz);
+        assert(memcmp(result->a, expected, esz * sizeof(uint32_t)) == 0);
+        printf("%d x %d words: ok\n", n, m);
+        
+        // Accumulating into a nonzero value takes the same kernels
+        precn_t acc = precn_new(1);
+        precn_t sum = precn_new(1);
+        precn_copy(acc, a);
+        precn_addmul(acc, a, b);
+        precn_add(sum, result, a);
+        assert(precn_cmp(acc, sum) == 0);
+        
+        free(expected);
+        precn_free(a);
+        precn_free(b);
+        precn_free(result);
+        precn_free(acc);
+        precn_free(sum);
+    }
+    
+    printf("Multiplication tests passed!\n\n");
+}
+
+#ifndef _WIN32
+// Values shared by every worker; nothing may write to them
+struct shared_operands {
+    precn_srcptr a, b, d, product, quotient, remainder;
+};
+
+static void *shared_reads_worker(void *arg) {
+    const struct shared_operands *s = (const struct shared_operands*)arg;
+    precn_t r = precn_new(1), q = precn_new(1), m = precn_new(1);
+    for (int iter = 0; iter < 3; iter++) {
+        precn_mul(r, s->a, s->b);
+        assert(precn_cmp(r, s->product) == 0);
+        precn_sqr(r, s->d);
+        precn_addmul(r, s->a, s->b);
+        precn_sub(r, r, s->product);
+        precn_sqr(m, s->d);
+        assert(precn_cmp(r, m) == 0);
+        assert(precn_divmod(q, m, s->a, s->d) == 0);
+        assert(precn_cmp(q, s->quotient) == 0 && precn_cmp(m, s->remainder) == 0);
+        assert(precn_divisible(s->product, s->b) == 1);
+        assert(precn_divexact(q, s->product, s->a) == 0 && precn_cmp(q, s->b) == 0);
+        precn_add_u64(r, s->a, 12345);
+        assert(precn_cmp(r, s->a) > 0 && precn_cmp_u64(s->d, 0) > 0);
+        precn_shr(r, s->a, 77);
+        precn_shl(m, r, 77);
+        assert(precn_cmp(m, s->a) <= 0);
+    }
+    precn_free(r);
+    precn_free(q);
+    precn_free(m);
+    return NULL;
+}
+#endif
+
+void test_shared_reads() {
+#ifndef _WIN32
+    printf("Testing concurrent reads of shared values...\n");
+    
+    srand(24680);
+    
+    precn_t a = random_precn(300);
+    precn_t b = random_precn(120);
+    precn_t d = random_precn(40);
+    precn_t product = precn_new(1), quotient = precn_new(1), remainder = precn_new(1);
+    precn_mul(product, a, b);
+    precn_divmod(quotient, remainder, a, d);
+    
+    struct shared_operands s = { a, b, d, product, quotient, remainder };
+    pthread_t threads[8];
+    for (int i = 0; i < 8; i++) {
+        assert(pthread_create(&threads[i], NULL, shared_reads_worker, &s) == 0);
+    }
+    for (int i = 0; i < 8; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    
+    precn_free(a);
+    precn_free(b);
+    precn_free(d);
+    precn_free(product);
+    precn_free(quotient);
+    precn_free(remainder);
+    
+    printf("Concurrent read tests passed!\n\n");
+#endif
+}
+
 int main() {
     printf("Testing precn high-precision library\n");
     printf("====================================\n\n");
@@ -543,8 +1196,18 @@ int main() {
     test_subtraction_with_borrow();
     test_division();
     test_modular_operations();
+    test_mulmod();
     test_random_modular();
     test_random_division();
+    test_serialization();
+    test_out_of_core_multiplication();
+    test_rns();
+    test_single_limb_division();
+    test_exact_division();
+    test_scalar_operations();
+    test_powers_and_factorials();
+    test_unbalanced_multiplication();
+    test_shared_reads();
     
     printf("All tests passed successfully!\n");
     return 0;